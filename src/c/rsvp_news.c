@@ -1,5 +1,8 @@
 #include <pebble.h>
 
+#include "rsvp_text.h"
+#include "rsvp_trace.h"
+
 // ============== DEMO MODE ==============
 // Set to 1 to enable demo mode (fixed phrase, manual word advance)
 // Set to 0 for normal operation
@@ -17,6 +20,14 @@ static bool s_demo_mode_active = false;
 static uint16_t s_demo_word_index = 0;
 // ========================================
 
+// ============== TRACE MODE ==============
+// Set to 1 (or build with -DTRACE_RECORD=1) to write a trace of the session
+// to the app log for tools/replay (see rsvp_trace.h)
+#ifndef TRACE_RECORD
+#define TRACE_RECORD 0
+#endif
+// ========================================
+
 // Spritz constants for optimal word display (relative to screen dimensions)
 #define SPRITZ_HEADER_Y 5 // Y position for HEADLINE/ARTICLE header
 #define SPRITZ_WORD_Y 55  // Y position of word center (moved up for header)
@@ -24,6 +35,9 @@ static uint16_t s_demo_word_index = 0;
 #define SPRITZ_LINE_BOTTOM_Y (SPRITZ_WORD_Y + 30) // Y of line below word
 #define SPRITZ_LINE_LENGTH 20  // Length of vertical guide lines
 #define SPRITZ_CIRCLE_RADIUS 5 // Radius of pivot indicator circle
+// Band between the guide lines that changes on every word
+#define SPRITZ_WORD_BAND_TOP (SPRITZ_LINE_TOP_Y + SPRITZ_CIRCLE_RADIUS + 1)
+#define SPRITZ_WORD_BAND_HEIGHT (SPRITZ_LINE_BOTTOM_Y - SPRITZ_WORD_BAND_TOP)
 
 // Message keys
 #define KEY_NEWS_TITLE 172
@@ -38,41 +52,236 @@ static uint16_t s_demo_word_index = 0;
 #define KEY_REQUEST_FEEDS 184
 #define KEY_SELECT_FEED 185
 #define KEY_FEEDS_COUNT 186
+#define KEY_NEWS_TITLES 187 // Batch of length-prefixed titles (byte array)
+#define KEY_ARTICLE_INDEX 188 // News index an article chunk belongs to
+#define KEY_ARTICLE_SEQ 189   // Article chunk sequence number
+#define KEY_ARTICLE_DONE 190  // Set on the last chunk of an article
+#define KEY_PERF_REPORT 191   // Perf counter summary for the phone log
+#define KEY_INBOX_SIZE 192    // Inbox size, sent with the feed selection
+#define KEY_NEWS_SEQ 193      // Sequence number of a title batch
+#define KEY_NEWS_ACK 194      // Next title batch expected
+#define KEY_NEWS_WINDOW 195   // Title batches accepted past the ack
+#define KEY_ARTICLE_URGENT 196 // Set when the user is waiting for the chunk
+#define KEY_FEED_LIST 197      // Feed names, each NUL-terminated (byte array)
+#define KEY_FEED_LIST_HASH 198 // Hash JS computed over the feed list
+#define KEY_CHUNK_WIDTH 199    // Max chunk width in pixels, 0 = single words
+
+// AppMessage inbox: as large as the platform allows, within a memory budget.
+// Aplite has 24 KB for the whole app, so it keeps the original 512 bytes.
+#if defined(PBL_PLATFORM_APLITE)
+#define INBOX_SIZE_BUDGET 512
+#else
+#define INBOX_SIZE_BUDGET 2048
+#endif
+// Longest perf report line with its NUL, every counter at its maximum
+#define PERF_REPORT_LEN 232
+#define OUTBOX_SIZE (PERF_REPORT_LEN + 8) // The report and its tuple header
+static uint32_t s_inbox_size = 0;
+
+// Persistent headline cache: a header key followed by data keys of up to
+// PERSIST_DATA_MAX_LENGTH bytes holding the packed pool strings
+#define PERSIST_KEY_FEED_CACHE 1000  // Feed list: 1000 + 2 data keys
+#define FEED_CACHE_CHUNKS 2
+#define PERSIST_KEY_TITLE_CACHE 1010 // Last feed's titles: 1010 + 12 data keys
+#define TITLE_CACHE_CHUNKS 12
+#define PERSIST_KEY_PERF_REPORT 1030 // Report of a session that closed unsent
+#define POOL_CACHE_VERSION 1
 
 // Main window and layers
 static Window *s_main_window;
-static Layer *s_canvas_layer;
+static Layer *s_canvas_layer; // Full screen: static chrome and other screens
+static Layer *s_word_layer;   // Word band only, redrawn on every word
+
+// Static chrome is kept in the frame buffer and only redrawn when stale
+static bool s_chrome_valid = false;
+static bool s_chrome_article_mode = false; // Header mode the chrome shows
 
 // Menu for journal selection
 static MenuLayer *s_menu_layer;
 static bool s_showing_menu = true;
 
+// String pool: NUL-terminated strings packed back to back with an offset
+// table, so short strings don't pay for the longest one
+typedef struct {
+  char *bytes;
+  uint16_t *offsets;
+  uint16_t capacity;  // Size of bytes
+  uint8_t max_count;  // Size of offsets
+  uint16_t used;      // Bytes in use
+  uint8_t count;      // Strings stored
+} StringPool;
+
 // Feed/Journal data
-static char feed_names[20][32];         // Store up to 20 feed names
-static uint8_t feed_count = 0;          // Number of stored feeds
+#define MAX_FEEDS 24
+#define MAX_FEED_NAME_LEN 47
+#define FEED_POOL_SIZE 384
+static char s_feed_pool_bytes[FEED_POOL_SIZE];
+static uint16_t s_feed_pool_offsets[MAX_FEEDS];
+static StringPool s_feed_pool = {s_feed_pool_bytes, s_feed_pool_offsets,
+                                 FEED_POOL_SIZE, MAX_FEEDS, 0, 0};
+static uint8_t feed_count = 0;          // Number of feeds in the pool
+static uint32_t s_feed_list_hash = 0;   // Hash of the cached list, 0 if none
+static bool s_feed_list_stale = false;  // JS has a list with another hash
+static bool s_feed_selection_lost = false; // Selection never reached JS
 static int8_t selected_feed_index = -1; // Currently selected feed
 
 // News data
-static char news_title[104] = "";
-static char news_titles[50][104];      // Store up to 50 news titles
-static uint8_t news_titles_count = 0;  // Number of stored titles
+#define MAX_NEWS_TITLES 64
+#define MAX_TITLE_LEN 159 // Must match MAX_TITLE_BYTES in JS
+#define TITLE_POOL_SIZE 3584
+static char news_title[MAX_TITLE_LEN + 1] = "";
+static char s_title_pool_bytes[TITLE_POOL_SIZE];
+static uint16_t s_title_pool_offsets[MAX_NEWS_TITLES];
+static StringPool s_title_pool = {s_title_pool_bytes, s_title_pool_offsets,
+                                  TITLE_POOL_SIZE, MAX_NEWS_TITLES, 0, 0};
 static int8_t current_news_index = -1; // Current news index (-1 = none)
-
-// Article data (only store one at a time to save memory)
-static char news_article[512] = "";    // Current article content
+static bool s_news_complete = false;   // JS signalled the end of the feed
+
+// Headlines shown from the persistent cache until fresh ones replace them
+typedef struct {
+  uint8_t version;
+  uint8_t count; // Strings saved
+  uint16_t used; // Bytes saved
+  uint32_t tag;  // What the strings belong to (feed name hash for titles)
+} PoolCacheHeader;
+static bool s_titles_from_cache = false;  // Title pool holds cached titles
+static bool s_refreshing_cache = false;   // Fresh titles replacing the cache
+static bool s_refresh_match_pending = false; // Title on screen not yet found
+
+// Article stream: sequence-numbered chunks land in a ring buffer and are
+// read while the rest are still arriving, so RAM stays bounded. A chunk fills
+// the inbox but for the other tuples, and the ring holds two of them.
+#define ARTICLE_RING_SIZE (2 * INBOX_SIZE_BUDGET) // Power of two
+#define ARTICLE_RING_MASK (ARTICLE_RING_SIZE - 1)
+#define ARTICLE_MESSAGE_OVERHEAD 64 // Must match ARTICLE_MESSAGE_OVERHEAD in JS
+#define ARTICLE_WORD_SLOTS 128 // Power of two
+#define ARTICLE_WORD_MASK (ARTICLE_WORD_SLOTS - 1)
+// Longer tokens are split so the one being read never pins more than this
+// much of the ring: it must stay below ARTICLE_RING_SIZE - s_article_chunk_max
+// (576 bytes on aplite) or no chunk would ever fit behind it
+#define ARTICLE_WORD_MAX 252
+#define ARTICLE_RETRY_MS 1000 // Starved reader asks for its chunk again
+static char s_article_ring[ARTICLE_RING_SIZE];
+static uint16_t s_article_head = 0;     // Stream offset of the next byte
+static uint16_t s_article_scan = 0;     // Stream offset tokenized so far
+static uint16_t s_article_word_start = 0;
+static bool s_article_in_word = false;
+static uint16_t s_article_word_offsets[ARTICLE_WORD_SLOTS]; // Stream offsets
+static uint8_t s_article_word_lengths[ARTICLE_WORD_SLOTS];
+static uint16_t s_article_word_count = 0; // Words tokenized so far
+static uint16_t s_article_next_seq = 0;   // Next chunk expected from JS
+static bool s_article_done = false;       // Last chunk received
+static bool s_article_requested = false;  // Chunk request in flight
+static bool s_article_starved = false;    // Reader waiting for next chunk
+static int8_t s_article_stream_index = -1; // News whose article is streamed
+static uint16_t s_article_chunk_max = 0;  // Unpacked bytes per chunk
 static bool s_reading_article = false; // True when reading article content
 static int8_t s_article_news_index =
     -1; // Index of the news whose article we're reading
 
+// Article prefetch: the first chunk of the displayed headline's article is
+// fetched while the title is read, so Select can start reading at once
+static uint32_t s_select_time_ms = 0;  // When Select asked for the article
+static uint16_t s_prefetch_hits = 0;   // Articles started from prefetch
+static uint16_t s_prefetch_misses = 0; // Articles that waited on the phone
+
 // RSVP (Rapid Serial Visual Presentation)
 static char rsvp_word[32] = "";
-static uint8_t rsvp_word_index = 0;
+static uint16_t rsvp_word_index = 0;
 static uint16_t rsvp_wpm_ms = 150; // 150ms per word (400 WPM)
-static AppTimer *rsvp_timer = NULL;
-static AppTimer *rsvp_start_timer = NULL;
-static AppTimer *page_number_timer = NULL;
 static bool s_backlight_enabled = true; // Keep backlight on during reading
 
+// Chunking: a flash holds the word at rsvp_word_index and, when it is short,
+// the words after it, as long as the group fits s_chunk_width centered on
+// its pivot letter (0 = one word per flash)
+#define CHUNK_MAX_WORDS 3
+#define CHUNK_WIDTH_MAX 120 // Span of the guide lines
+static uint8_t s_chunk_width = 0;
+static uint8_t s_chunk_words = 0;      // Words in the flash on screen
+static uint8_t s_chunk_last = 0;       // Offset of its last word in rsvp_word
+static uint16_t s_chunk_single_ms = 0; // Its words' delays one at a time
+
+// Word pacing: every word ends at an absolute deadline, the previous one plus
+// its Spritz delay, so callback work and timer slop don't add up over a text
+static uint32_t s_word_deadline_ms = 0; // When the word on screen ends
+static uint32_t s_pacing_start_ms = 0;  // When the first word was shown
+static uint32_t s_pacing_target_ms = 0; // Sum of the words' delays
+static uint32_t s_pacing_stall_ms = 0;  // Time lost to stalls, not paced
+static uint32_t s_pacing_single_ms = 0; // The same words one per flash
+static uint32_t s_jitter_sum_ms = 0;    // Sum of word start lateness
+static uint16_t s_jitter_max_ms = 0;
+static uint16_t s_pacing_words = 0;
+static uint16_t s_pacing_flashes = 0;
+static PacingState s_pacing_model;      // Mean word weight of the text
+
+// Performance counters, shown on the diagnostics screen (long press Select)
+// and sent to the phone log when a reading session ends
+typedef struct {
+  uint16_t msgs_in;        // AppMessages received
+  uint16_t msgs_out;       // AppMessages delivered
+  uint16_t msgs_dropped;   // Inbox drops
+  uint16_t msgs_failed;    // Outbox failures
+  uint16_t title_timeouts; // Acks repeated because no title batch came
+  uint16_t first_title_ms; // Feed selected to first title, last session
+  uint16_t first_word_ms;  // Select to first article word, last article
+  uint16_t render_max_ms;  // Slowest frame
+  uint32_t render_total_ms;
+  uint16_t render_count;
+  uint16_t last_wpm;       // Achieved WPM of the last text read
+  uint8_t chunk_gain_pct;  // Target WPM gained by chunking, last text
+  uint32_t heap_min_free;  // Lowest free heap seen
+  uint32_t wakeups;        // Event timer wakeups
+  uint32_t events_run;     // Timed events run
+  uint32_t event_late_total_ms; // Their lateness past the due time
+  uint16_t event_late_max_ms;
+  uint16_t light_renewals; // Backlight interactions started
+  uint32_t light_on_ms;    // Backlight time up to the last renewal
+} PerfCounters;
+static PerfCounters s_perf = {.heap_min_free = UINT32_MAX};
+static uint32_t s_frame_start_ms = 0; // When the canvas began the frame
+static bool s_frame_open = false;     // Word layer still to draw this frame
+static bool s_perf_reported = false;  // Final report sent before closing
+static bool s_perf_report_saved = false; // Last session's report to send
+
+// Power: while reading, the backlight is renewed shortly before the shortest
+// system timeout instead of on every word, and events that can run a little
+// late are moved onto the next planned wakeup so both share it.
+// The counters above feed a rough energy estimate for the session, from
+// typical costs of each event on a watch of this class.
+#define BACKLIGHT_TIMEOUT_MS 3000 // Shortest system backlight timeout
+#define BACKLIGHT_RENEW_MS 2500
+#define WAKEUP_SLACK_MS 150        // How late a coalesced timer may fire
+#define ENERGY_WAKEUP_UJ 30        // CPU out of stop mode and back
+#define ENERGY_FRAME_UJ 150        // Render and display update
+#define ENERGY_MESSAGE_UJ 1000     // AppMessage over Bluetooth LE
+#define ENERGY_LIGHT_UJ_PER_MS 20  // Backlight on
+static uint32_t s_light_renewed_ms = 0; // Last light_enable_interaction()
+static bool s_light_renewed = false;
+static uint32_t s_feed_select_time_ms = 0; // When the feed was selected
+static bool s_showing_diagnostics = false;
+
+// Glyph advance widths for FONT_KEY_GOTHIC_28, measured lazily (0 = unknown)
+#define GLYPH_CACHE_FIRST ' '
+#define GLYPH_CACHE_LAST '~'
+static uint8_t s_glyph_widths[GLYPH_CACHE_LAST - GLYPH_CACHE_FIRST + 1];
+
+// Render plan for the word in rsvp_word, built once per word so redraws never
+// touch the text layout engine
+typedef struct {
+  char word[32];         // Word this plan was built for
+  char parts[34];        // Pre-pivot, pivot and post-pivot, NUL-separated
+  uint8_t pivot_offset;  // Start of the pivot part in parts
+  uint8_t post_offset;   // Start of the post-pivot part in parts
+  int16_t pre_width;     // Width of the text before the pivot letter
+  int16_t pivot_width;   // Width of the pivot letter
+  int16_t x_offset;      // Word x position relative to the pivot line
+} RenderPlan;
+static RenderPlan s_render_plan;
+
+// Words of the title being read, indexed when the text arrives so the RSVP
+// timer can fetch word N directly
+static WordIndex s_title_words;
+
 // Display states
 static bool s_splash_active = false;
 static bool s_end_screen = false;
@@ -85,22 +294,329 @@ static bool s_first_news_after_splash =
 
 // News rotation
 static uint8_t news_display_count = 0;
-static uint8_t news_max_count = 50;
-static AppTimer *news_timer = NULL;
-static AppTimer *end_timer = NULL;
+static uint8_t news_max_count = MAX_NEWS_TITLES;
 static bool s_user_navigating = false; // True when user manually navigates
 
 // News retry protection
 static uint8_t news_retry_count = 0;
 static uint8_t news_max_retries = 3;
 
+// Title stream: JS pushes sequence-numbered batches, at most NEWS_WINDOW past
+// the last ack. EVENT_NEWS is a watchdog that repeats the ack when batches
+// stop arriving, which makes JS resend from there.
+#define NEWS_WINDOW 2 // Must match NEWS_WINDOW in JS
+#define NEWS_WATCHDOG_MS 8000
+static uint16_t s_news_expected_seq = 0; // Next batch expected
+static bool s_news_ack_pending = false;  // Ack waiting for a free outbox
+
+// Timed events: every delayed action is an event in a small min-heap by due
+// time, and a single AppTimer is armed for the earliest one. A type has at
+// most one event pending; scheduling it again or cancelling it bumps the
+// type's generation, so an outdated heap entry is dropped when it surfaces.
+typedef enum {
+  EVENT_RSVP,        // Next flash
+  EVENT_RSVP_START,  // First flash after the splash
+  EVENT_PAGE_NUMBER, // Page number after a title
+  EVENT_NEWS,        // Title ack retry and watchdog
+  EVENT_END,         // Close after the error screen
+  EVENT_TYPE_COUNT
+} EventType;
+typedef struct {
+  uint32_t due_ms;
+  uint8_t type;
+  uint8_t generation;
+} ScheduledEvent;
+#define EVENT_HEAP_MAX 16
+static ScheduledEvent s_event_heap[EVENT_HEAP_MAX];
+static uint8_t s_event_count = 0;
+static uint8_t s_event_generation[EVENT_TYPE_COUNT];
+static uint8_t s_events_pending = 0; // One bit per type
+static AppTimer *s_event_timer = NULL;
+static uint32_t s_event_timer_due_ms = 0;
+static bool s_events_running = false; // Re-armed once all due events ran
+
 // Forward declarations
 static void news_timer_callback(void *context);
+static void rsvp_timer_callback(void *context);
+static void rsvp_start_timer_callback(void *context);
+static void page_number_timer_callback(void *context);
+static void end_timer_callback(void *context);
+static void schedule_event(EventType type, uint32_t delay_ms);
+static void cancel_event(EventType type);
+static void cancel_all_events(void);
 static void show_journal_menu(void);
 static void hide_journal_menu(void);
 static void click_config_provider(void *context);
 static void menu_click_config_provider(void *context);
 static void back_click_handler(ClickRecognizerRef recognizer, void *context);
+static void invalidate_chrome(void);
+static void mark_word_dirty(void);
+static void start_rsvp_for_title(void);
+static void display_news_at_index(int8_t index);
+static uint32_t now_ms(void);
+static uint32_t coalesce_wakeup(uint32_t ms);
+
+#if TRACE_RECORD
+// Session trace, logged a line at a time as records fill it. Large messages
+// take a few lines, so traced builds run a little slower.
+static uint8_t s_trace_line[TRACE_LINE_BYTES];
+static uint8_t s_trace_used = 0;
+static uint16_t s_trace_lines = 0;
+static uint32_t s_trace_last_ms = 0;
+
+// Persisted keys a replay needs to start from the same state, first to last
+static const uint32_t TRACE_PERSIST_KEYS[][2] = {
+    {KEY_READING_SPEED_WPM, KEY_READING_SPEED_WPM},
+    {KEY_BACKLIGHT_ENABLED, KEY_BACKLIGHT_ENABLED},
+    {KEY_CHUNK_WIDTH, KEY_CHUNK_WIDTH},
+    {PERSIST_KEY_FEED_CACHE, PERSIST_KEY_FEED_CACHE + FEED_CACHE_CHUNKS},
+    {PERSIST_KEY_TITLE_CACHE, PERSIST_KEY_TITLE_CACHE + TITLE_CACHE_CHUNKS},
+    {PERSIST_KEY_PERF_REPORT, PERSIST_KEY_PERF_REPORT},
+};
+
+// Log the buffered bytes as the next trace line
+static void trace_flush(void) {
+  static const char digits[] = "0123456789abcdef";
+  if (s_trace_used == 0) {
+    return;
+  }
+  char hex[TRACE_LINE_BYTES * 2 + 1];
+  for (uint8_t i = 0; i < s_trace_used; i++) {
+    hex[2 * i] = digits[s_trace_line[i] >> 4];
+    hex[2 * i + 1] = digits[s_trace_line[i] & 0xF];
+  }
+  hex[2 * s_trace_used] = '\0';
+  APP_LOG(APP_LOG_LEVEL_DEBUG, "TRACE %d %s", s_trace_lines++, hex);
+  s_trace_used = 0;
+}
+
+static void trace_put(const void *data, uint16_t length) {
+  const uint8_t *bytes = data;
+  for (uint16_t i = 0; i < length; i++) {
+    s_trace_line[s_trace_used++] = bytes[i];
+    if (s_trace_used == TRACE_LINE_BYTES) {
+      trace_flush();
+    }
+  }
+}
+
+static void trace_put_varint(uint32_t value) {
+  uint8_t byte;
+  while (value >= 0x80) {
+    byte = (value & 0x7F) | 0x80;
+    trace_put(&byte, 1);
+    value >>= 7;
+  }
+  byte = value;
+  trace_put(&byte, 1);
+}
+
+// Start a record; its payload follows with trace_put()
+static void trace_begin(TraceKind kind, uint16_t payload_length) {
+  uint32_t now = now_ms();
+  uint8_t byte = kind;
+  trace_put(&byte, 1);
+  trace_put_varint(now - s_trace_last_ms);
+  trace_put_varint(payload_length);
+  s_trace_last_ms = now;
+}
+
+// Start the trace with the persisted state the session starts from
+static void trace_start(void) {
+  s_trace_last_ms = now_ms();
+  uint8_t version = TRACE_VERSION;
+  uint32_t inbox_max = app_message_inbox_size_maximum();
+  trace_begin(TRACE_START, 5);
+  trace_put(&version, 1);
+  trace_put(&inbox_max, 4);
+
+  uint8_t data[PERSIST_DATA_MAX_LENGTH];
+  for (uint8_t range = 0; range < ARRAY_LENGTH(TRACE_PERSIST_KEYS); range++) {
+    for (uint32_t key = TRACE_PERSIST_KEYS[range][0];
+         key <= TRACE_PERSIST_KEYS[range][1]; key++) {
+      int size = persist_get_size(key);
+      if (size <= 0 || persist_read_data(key, data, size) != size) {
+        continue;
+      }
+      trace_begin(TRACE_PERSIST, 4 + size);
+      trace_put(&key, 4);
+      trace_put(data, size);
+    }
+  }
+}
+
+static void trace_click(ClickRecognizerRef recognizer, bool long_click) {
+  uint8_t payload[2] = {click_recognizer_get_button_id(recognizer),
+                        long_click};
+  trace_begin(TRACE_CLICK, sizeof(payload));
+  trace_put(payload, sizeof(payload));
+}
+
+// Record every tuple of an inbound message
+static void trace_inbox(DictionaryIterator *iterator) {
+  uint16_t length = 0;
+  for (Tuple *tuple = dict_read_first(iterator); tuple;
+       tuple = dict_read_next(iterator)) {
+    length += 7 + tuple->length;
+  }
+  trace_begin(TRACE_INBOX, length);
+  for (Tuple *tuple = dict_read_first(iterator); tuple;
+       tuple = dict_read_next(iterator)) {
+    uint32_t key = tuple->key;
+    uint8_t type = tuple->type;
+    uint16_t tuple_length = tuple->length;
+    trace_put(&key, 4);
+    trace_put(&type, 1);
+    trace_put(&tuple_length, 2);
+    trace_put(tuple->value->data, tuple_length);
+  }
+}
+
+static void trace_message_result(TraceKind kind, AppMessageResult reason) {
+  uint16_t value = reason;
+  trace_begin(kind, 2);
+  trace_put(&value, 2);
+}
+
+static void trace_event(EventType type) {
+  uint8_t byte = type;
+  trace_begin(TRACE_EVENT, 1);
+  trace_put(&byte, 1);
+}
+
+// Record that the outbox message went out
+static void trace_outbox_sent(void) { trace_begin(TRACE_OUTBOX_SENT, 0); }
+
+// End the trace and log what is left of it
+static void trace_end(void) {
+  trace_begin(TRACE_END, 0);
+  trace_flush();
+}
+#else
+static void trace_start(void) {}
+static void trace_click(ClickRecognizerRef recognizer, bool long_click) {}
+static void trace_inbox(DictionaryIterator *iterator) {}
+static void trace_message_result(TraceKind kind, AppMessageResult reason) {}
+static void trace_event(EventType type) {}
+static void trace_outbox_sent(void) {}
+static void trace_end(void) {}
+#endif
+
+// Empty a string pool
+static void pool_reset(StringPool *pool) {
+  pool->used = 0;
+  pool->count = 0;
+}
+
+// Append a string of the given length; false when the pool is full
+static bool pool_add(StringPool *pool, const char *text, uint16_t len) {
+  if (pool->count >= pool->max_count ||
+      pool->used + len + 1 > pool->capacity) {
+    return false;
+  }
+  pool->offsets[pool->count++] = pool->used;
+  memcpy(&pool->bytes[pool->used], text, len);
+  pool->bytes[pool->used + len] = '\0';
+  pool->used += len + 1;
+  return true;
+}
+
+// Get string i, or "" if it hasn't been stored
+static const char *pool_get(const StringPool *pool, int i) {
+  if (i < 0 || i >= pool->count) {
+    return "";
+  }
+  return &pool->bytes[pool->offsets[i]];
+}
+
+// Log how full a pool is
+static void pool_log(const StringPool *pool, const char *name) {
+  APP_LOG(APP_LOG_LEVEL_INFO, "%s pool: %d/%d strings, %d/%d bytes", name,
+          pool->count, pool->max_count, pool->used, pool->capacity);
+}
+
+// FNV-1a hash of a string, used to tag cached data
+static uint32_t hash_string(const char *text) {
+  uint32_t hash = 2166136261u;
+  while (*text) {
+    hash = (hash ^ (uint8_t)*text++) * 16777619u;
+  }
+  return hash;
+}
+
+// Save the leading strings of a pool that fit in max_chunks data keys after
+// the header key. The header is removed first and written last, so an
+// interrupted save is never loaded.
+static void pool_persist(const StringPool *pool, uint32_t key,
+                         uint8_t max_chunks, uint32_t tag) {
+  PoolCacheHeader header = {POOL_CACHE_VERSION, pool->count, pool->used, tag};
+  while (header.used > max_chunks * PERSIST_DATA_MAX_LENGTH) {
+    header.count--;
+    header.used = pool->offsets[header.count];
+  }
+
+  persist_delete(key);
+  uint32_t chunk_key = key + 1;
+  for (uint16_t pos = 0; pos < header.used; pos += PERSIST_DATA_MAX_LENGTH) {
+    uint16_t len = header.used - pos;
+    if (len > PERSIST_DATA_MAX_LENGTH) {
+      len = PERSIST_DATA_MAX_LENGTH;
+    }
+    persist_write_data(chunk_key++, &pool->bytes[pos], len);
+  }
+  persist_write_data(key, &header, sizeof(header));
+  APP_LOG(APP_LOG_LEVEL_INFO, "Cached %d strings (%d bytes) at key %lu",
+          header.count, header.used, key);
+}
+
+// Tag of the pool saved at key, 0 if there is none
+static uint32_t pool_cached_tag(uint32_t key) {
+  PoolCacheHeader header;
+  if (persist_read_data(key, &header, sizeof(header)) != sizeof(header) ||
+      header.version != POOL_CACHE_VERSION) {
+    return 0;
+  }
+  return header.tag;
+}
+
+// Load a pool saved by pool_persist; false if there is none or its tag
+// doesn't match
+static bool pool_restore(StringPool *pool, uint32_t key, uint32_t tag) {
+  PoolCacheHeader header;
+  if (persist_read_data(key, &header, sizeof(header)) != sizeof(header) ||
+      header.version != POOL_CACHE_VERSION || header.tag != tag ||
+      header.used > pool->capacity || header.count > pool->max_count) {
+    return false;
+  }
+
+  uint32_t chunk_key = key + 1;
+  for (uint16_t pos = 0; pos < header.used; pos += PERSIST_DATA_MAX_LENGTH) {
+    uint16_t len = header.used - pos;
+    if (len > PERSIST_DATA_MAX_LENGTH) {
+      len = PERSIST_DATA_MAX_LENGTH;
+    }
+    if (persist_read_data(chunk_key++, &pool->bytes[pos], len) != len) {
+      pool_reset(pool);
+      return false;
+    }
+  }
+
+  // Rebuild the offset table from the string terminators
+  pool_reset(pool);
+  uint16_t start = 0;
+  for (uint16_t i = 0; i < header.used && pool->count < header.count; i++) {
+    if (pool->bytes[i] == '\0') {
+      pool->offsets[pool->count++] = start;
+      start = i + 1;
+    }
+  }
+  pool->used = start;
+  if (pool->count != header.count) {
+    pool_reset(pool);
+    return false;
+  }
+  return true;
+}
 
 #if DEMO_MODE
 // Extract word at index from demo phrase
@@ -154,12 +670,12 @@ static bool extract_demo_word(uint16_t word_idx) {
 static void demo_advance_word(void) {
   s_demo_word_index++;
   if (extract_demo_word(s_demo_word_index)) {
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
   } else {
     // End of demo phrase - wrap to beginning
     s_demo_word_index = 0;
     extract_demo_word(0);
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
   }
 }
 
@@ -171,115 +687,92 @@ static void start_demo_mode(void) {
   s_reading_article = false; // Show "HEADLINE" header
 
   // Cancel any existing timers
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-    rsvp_timer = NULL;
-  }
-  if (rsvp_start_timer) {
-    app_timer_cancel(rsvp_start_timer);
-    rsvp_start_timer = NULL;
-  }
+  cancel_event(EVENT_RSVP);
+  cancel_event(EVENT_RSVP_START);
 
   // Display first word
   extract_demo_word(0);
-  layer_mark_dirty(s_canvas_layer);
+  mark_word_dirty();
 }
 #endif
 
-// Calculate the optimal recognition point (ORP) / pivot letter index
-// Based on Spritz algorithm from OpenSpritz
-static int get_pivot_index(int word_length) {
-  if (word_length <= 0)
-    return 0;
-
-  switch (word_length) {
-  case 1:
-    return 0; // first letter (index 0)
-  case 2:
-  case 3:
-  case 4:
-  case 5:
-    return 1; // second letter (index 1)
-  case 6:
-  case 7:
-  case 8:
-  case 9:
-    return 2; // third letter (index 2)
-  case 10:
-  case 11:
-  case 12:
-  case 13:
-    return 3; // fourth letter (index 3)
-  default:
-    return 4; // fifth letter (index 4)
-  }
-}
-
-// Get the width of a string segment using the given font
-static int get_text_width(GContext *ctx, const char *text, int length,
-                          GFont font) {
-  if (length <= 0 || !text)
-    return 0;
-
-  // Create a temporary buffer for the substring
-  char temp[32];
-  int copy_len = (length < 31) ? length : 31;
-  memcpy(temp, text, copy_len);
-  temp[copy_len] = '\0';
-
+// Measure a string with the text layout engine (slow path)
+static int measure_text_width(const char *text, GFont font) {
   GSize size = graphics_text_layout_get_content_size(
-      temp, font, GRect(0, 0, 500, 50), GTextOverflowModeTrailingEllipsis,
+      text, font, GRect(0, 0, 500, 50), GTextOverflowModeTrailingEllipsis,
       GTextAlignmentLeft);
   return size.w;
 }
 
-// Get the width of a single character
-static int get_char_width(GContext *ctx, char c, GFont font) {
-  char temp[2] = {c, '\0'};
-  GSize size = graphics_text_layout_get_content_size(
-      temp, font, GRect(0, 0, 100, 50), GTextOverflowModeTrailingEllipsis,
-      GTextAlignmentLeft);
-  return size.w;
-}
-
-// Calculate Spritz-style delay for a word
-// Based on OpenSpritz algorithm: longer pause for punctuation and long words
-static uint16_t calculate_spritz_delay(const char *word) {
-  if (!word || word[0] == '\0') {
-    return rsvp_wpm_ms;
+// Get the advance width of a printable ASCII character from the glyph cache
+static int get_glyph_width(char c, GFont font) {
+  uint8_t *cached = &s_glyph_widths[c - GLYPH_CACHE_FIRST];
+  if (*cached == 0) {
+    char temp[2] = {c, '\0'};
+    int width = measure_text_width(temp, font);
+    *cached = (width > 0 && width < 255) ? width : 1;
   }
+  return *cached;
+}
 
-  uint16_t delay = rsvp_wpm_ms;
-  int len = strlen(word);
-
-  // Check last character for punctuation
-  char last_char = word[len - 1];
+// Get the width of a string segment using the given font
+static int get_text_width(const char *text, int length, GFont font) {
+  if (length <= 0 || !text)
+    return 0;
 
-  // Strong pause for sentence-ending punctuation (. ! ?)
-  if (last_char == '.' || last_char == '!' || last_char == '?') {
-    delay = rsvp_wpm_ms * 3; // Triple delay for sentence end
-  }
-  // Medium pause for clause-ending punctuation (, : ; ))
-  else if (last_char == ',' || last_char == ':' || last_char == ';' ||
-           last_char == ')') {
-    delay = rsvp_wpm_ms * 2; // Double delay for clause break
-  }
-  // Check for opening parenthesis or dash (mid-word pause)
-  else {
-    for (int i = 0; i < len; i++) {
-      if (word[i] == '(' || word[i] == '-') {
-        delay = rsvp_wpm_ms + (rsvp_wpm_ms / 2); // 1.5x delay
-        break;
-      }
+  int width = 0;
+  for (int i = 0; i < length; i++) {
+    char c = text[i];
+    if (c < GLYPH_CACHE_FIRST || c > GLYPH_CACHE_LAST) {
+      // Non-ASCII (UTF-8) text: measure the whole segment once
+      char temp[32];
+      int copy_len = (length < 31) ? length : 31;
+      memcpy(temp, text, copy_len);
+      temp[copy_len] = '\0';
+      return measure_text_width(temp, font);
     }
+    width += get_glyph_width(c, font);
   }
+  return width;
+}
 
-  // Extra time for long words (> 8 characters)
-  if (len > 8) {
-    delay += rsvp_wpm_ms; // Add extra time for long words
-  }
+// Build the render plan for a word: pivot letter, split points and widths
+static void build_render_plan(const char *word, GFont font) {
+  RenderPlan *plan = &s_render_plan;
+  int word_length = strlen(word);
+  if (word_length > (int)sizeof(plan->word) - 1) {
+    word_length = sizeof(plan->word) - 1;
+  }
+  memcpy(plan->word, word, word_length);
+  plan->word[word_length] = '\0';
+
+  // Get the pivot index based on Spritz algorithm, on a whole letter
+  int pivot_idx = get_text_pivot_index(word, word_length);
+  int pivot_len = 1;
+  while (pivot_idx + pivot_len < word_length &&
+         ((uint8_t)word[pivot_idx + pivot_len] & 0xC0) == 0x80) {
+    pivot_len++;
+  }
+  int post_len = word_length - pivot_idx - pivot_len;
+
+  // Split the word into parts: "pre\0pivot\0post\0"
+  char *parts = plan->parts;
+  memcpy(parts, word, pivot_idx);
+  parts[pivot_idx] = '\0';
+  plan->pivot_offset = pivot_idx + 1;
+  memcpy(&parts[plan->pivot_offset], &word[pivot_idx], pivot_len);
+  parts[plan->pivot_offset + pivot_len] = '\0';
+  plan->post_offset = plan->pivot_offset + pivot_len + 1;
+  memcpy(&parts[plan->post_offset], &word[pivot_idx + pivot_len], post_len);
+  parts[plan->post_offset + post_len] = '\0';
+
+  // Calculate widths for positioning
+  plan->pre_width = get_text_width(word, pivot_idx, font);
+  plan->pivot_width = get_text_width(&word[pivot_idx], pivot_len, font);
 
-  return delay;
+  // The pivot letter's center should be at the pivot line
+  // Shift 3 pixels to the left
+  plan->x_offset = -plan->pre_width - (plan->pivot_width / 2) + 2 - 3;
 }
 
 // Menu layer callbacks
@@ -293,8 +786,8 @@ static void menu_draw_row_callback(GContext *ctx, const Layer *cell_layer,
   if (feed_count == 0) {
     menu_cell_basic_draw(ctx, cell_layer, "Loading...", NULL, NULL);
   } else {
-    menu_cell_basic_draw(ctx, cell_layer, feed_names[cell_index->row], NULL,
-                         NULL);
+    menu_cell_basic_draw(ctx, cell_layer,
+                         pool_get(&s_feed_pool, cell_index->row), NULL, NULL);
 
     // Draw a separator line at the bottom of each cell
     GRect bounds = layer_get_bounds(cell_layer);
@@ -304,34 +797,64 @@ static void menu_draw_row_callback(GContext *ctx, const Layer *cell_layer,
   }
 }
 
+// Send the selected feed to JS, which answers with its headlines
+static void send_feed_selection(void) {
+  DictionaryIterator *iter;
+  AppMessageResult result = app_message_outbox_begin(&iter);
+  s_feed_selection_lost = result != APP_MSG_OK;
+  if (result == APP_MSG_OK) {
+    dict_write_uint8(iter, KEY_SELECT_FEED, selected_feed_index);
+    dict_write_uint16(iter, KEY_INBOX_SIZE, s_inbox_size);
+    app_message_outbox_send();
+    APP_LOG(APP_LOG_LEVEL_INFO, "Feed selection sent");
+  }
+}
+
 static void menu_select_callback(MenuLayer *menu_layer, MenuIndex *cell_index,
                                  void *data) {
   if (feed_count == 0)
     return;
 
   selected_feed_index = cell_index->row;
+  s_feed_select_time_ms = now_ms();
   APP_LOG(APP_LOG_LEVEL_INFO, "Selected feed: %d - %s", selected_feed_index,
-          feed_names[selected_feed_index]);
+          pool_get(&s_feed_pool, selected_feed_index));
 
   // Send feed selection to JS
-  DictionaryIterator *iter;
-  AppMessageResult result = app_message_outbox_begin(&iter);
-  if (result == APP_MSG_OK) {
-    dict_write_uint8(iter, KEY_SELECT_FEED, selected_feed_index);
-    app_message_outbox_send();
-    APP_LOG(APP_LOG_LEVEL_INFO, "Feed selection sent");
-  }
+  send_feed_selection();
 
   // Hide menu and show loading state
   hide_journal_menu();
 
   // Reset news data
-  news_titles_count = 0;
+  pool_reset(&s_title_pool);
   current_news_index = -1;
   news_title[0] = '\0';
+  s_news_complete = false;
+  s_news_expected_seq = 0;
+  s_news_ack_pending = false;
+  news_retry_count = 0;
   rsvp_word[0] = '\0';
   s_first_news_after_splash = true;
   s_user_navigating = false;
+  s_refreshing_cache = false;
+  s_refresh_match_pending = false;
+
+  // Show the headlines cached for this feed while fresh ones load
+  s_titles_from_cache =
+      pool_restore(&s_title_pool, PERSIST_KEY_TITLE_CACHE,
+                   hash_string(pool_get(&s_feed_pool, selected_feed_index))) &&
+      s_title_pool.count > 0;
+  if (s_titles_from_cache) {
+    pool_log(&s_title_pool, "Cached title");
+    current_news_index = 0;
+    snprintf(news_title, sizeof(news_title), "%s",
+             pool_get(&s_title_pool, 0));
+    start_rsvp_for_title();
+  }
+
+  // JS pushes the first batches on its own; watch for them
+  schedule_event(EVENT_NEWS, coalesce_wakeup(NEWS_WATCHDOG_MS));
 
   layer_mark_dirty(s_canvas_layer);
 }
@@ -339,16 +862,19 @@ static void menu_select_callback(MenuLayer *menu_layer, MenuIndex *cell_index,
 // Menu-specific click handlers
 static void menu_up_click_handler(ClickRecognizerRef recognizer,
                                   void *context) {
+  trace_click(recognizer, false);
   menu_layer_set_selected_next(s_menu_layer, true, MenuRowAlignCenter, true);
 }
 
 static void menu_down_click_handler(ClickRecognizerRef recognizer,
                                     void *context) {
+  trace_click(recognizer, false);
   menu_layer_set_selected_next(s_menu_layer, false, MenuRowAlignCenter, true);
 }
 
 static void menu_select_click_handler(ClickRecognizerRef recognizer,
                                       void *context) {
+  trace_click(recognizer, false);
   MenuIndex index = menu_layer_get_selected_index(s_menu_layer);
   menu_select_callback(s_menu_layer, &index, NULL);
 }
@@ -360,6 +886,16 @@ static void menu_click_config_provider(void *context) {
   window_single_click_subscribe(BUTTON_ID_BACK, back_click_handler);
 }
 
+// Hide the diagnostics screen; true if it was showing
+static bool hide_diagnostics(void) {
+  if (!s_showing_diagnostics) {
+    return false;
+  }
+  s_showing_diagnostics = false;
+  invalidate_chrome();
+  return true;
+}
+
 static void show_journal_menu(void) {
   if (!s_menu_layer)
     return;
@@ -380,13 +916,14 @@ static void hide_journal_menu(void) {
   s_showing_menu = false;
   layer_set_hidden(menu_layer_get_layer(s_menu_layer), true);
   layer_set_hidden(s_canvas_layer, false);
+  invalidate_chrome();
 
   // Set canvas click config
   window_set_click_config_provider(s_main_window, click_config_provider);
 }
 
-// Draw Spritz-style RSVP word display with pivot letter highlighting
-static void draw_rsvp_word(GContext *ctx, GRect bounds) {
+// Draw the static RSVP chrome: header, guide lines, pivot circle and help
+static void draw_rsvp_chrome(GContext *ctx, GRect bounds) {
   int width = bounds.size.w;
   int height = bounds.size.h;
   int pivot_x = width / 2;
@@ -420,93 +957,68 @@ static void draw_rsvp_word(GContext *ctx, GRect bounds) {
   graphics_draw_circle(ctx, GPoint(pivot_x, SPRITZ_LINE_TOP_Y),
                        SPRITZ_CIRCLE_RADIUS);
 
-  // Handle empty or null word
-  const char *word = (rsvp_word[0] != '\0') ? rsvp_word : "";
-  if (word[0] == '\0') {
-    // Even when no word is displayed, show navigation help and counter
-    // Draw navigation help at bottom in small font, left-aligned, 3 lines
-    GFont font_help = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    graphics_context_set_text_color(ctx, GColorWhite);
-
-    // Build help text based on current mode (3 separate lines)
-    const char *help_line1 = "Arrows: navigation";
-    const char *help_line2;
-    const char *help_line3;
+  // Draw navigation help at bottom in small font, left-aligned, 3 lines
+  GFont font_help = fonts_get_system_font(FONT_KEY_GOTHIC_14);
+  graphics_context_set_text_color(ctx, GColorWhite);
 
-    if (s_reading_article) {
-      help_line2 = "Select: stop";
-      help_line3 = "Back: title";
-    } else {
-      help_line2 = "Select: read";
-      help_line3 = "Back: menu";
-    }
+  // Build help text based on current mode (3 separate lines)
+  const char *help_line1 = "Arrows: navigation";
+  const char *help_line2;
+  const char *help_line3;
 
-    graphics_draw_text(
-        ctx, help_line1, font_help, GRect(5, help_y, width - 10, 18),
-        GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    graphics_draw_text(
-        ctx, help_line2, font_help, GRect(5, help_y + 15, width - 10, 18),
-        GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    graphics_draw_text(
-        ctx, help_line3, font_help, GRect(5, help_y + 30, width - 10, 18),
-        GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    return;
+  if (s_reading_article) {
+    help_line2 = "Select: stop";
+    help_line3 = "Back: title";
+  } else {
+    help_line2 = "Select: read";
+    help_line3 = "Back: menu";
   }
 
-  // Calculate word length
-  int word_length = strlen(word);
-  if (word_length == 0)
-    return;
+  graphics_draw_text(
+      ctx, help_line1, font_help, GRect(5, help_y, width - 10, 18),
+      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+  graphics_draw_text(
+      ctx, help_line2, font_help, GRect(5, help_y + 15, width - 10, 18),
+      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+  graphics_draw_text(
+      ctx, help_line3, font_help, GRect(5, help_y + 30, width - 10, 18),
+      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+}
+
+// Draw Spritz-style RSVP word with pivot letter highlighting into the band
+// between the guide lines (bounds are the word layer's own bounds)
+static void draw_rsvp_word(GContext *ctx, GRect bounds) {
+  int width = bounds.size.w;
+  int pivot_x = width / 2;
 
-  // Get the pivot index based on Spritz algorithm
-  int pivot_idx = get_pivot_index(word_length);
+  // Clear the band
+  graphics_context_set_fill_color(ctx, GColorBlack);
+  graphics_fill_rect(ctx, bounds, 0, GCornerNone);
 
-  // Safety check: ensure pivot_idx is within bounds
-  if (pivot_idx >= word_length) {
-    pivot_idx = word_length - 1;
-  }
-  if (pivot_idx < 0) {
-    pivot_idx = 0;
+  // Handle empty or null word
+  const char *word = (rsvp_word[0] != '\0') ? rsvp_word : "";
+  if (word[0] == '\0') {
+    return;
   }
 
   // Font for word display
   GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_28);
 
-  // Calculate widths for positioning
-  // Width of text before pivot letter
-  int pre_pivot_width = get_text_width(ctx, word, pivot_idx, font);
-  // Width of the pivot letter itself
-  int pivot_char_width = get_char_width(ctx, word[pivot_idx], font);
+  // Rebuild the render plan only when the word changes
+  const RenderPlan *plan = &s_render_plan;
+  if (strcmp(plan->word, word) != 0) {
+    build_render_plan(word, font);
+  }
 
   // Calculate X position so pivot letter is centered at pivot_x
-  // The pivot letter's center should be at pivot_x
-  // Shift 3 pixels to the left
-  int word_x = pivot_x - pre_pivot_width - (pivot_char_width / 2) + 2 - 3;
+  int word_x = pivot_x + plan->x_offset;
 
-  // Y position for text
-  int text_y = SPRITZ_WORD_Y - 16; // Adjust for font baseline
+  // Y position for text, relative to the band
+  int text_y = SPRITZ_WORD_Y - 16 - SPRITZ_WORD_BAND_TOP;
 
-  // Create buffers for the three parts of the word
-  char pre_pivot[32] = "";
-  char pivot_char[2] = "";
-  char post_pivot[32] = "";
-
-  // Split the word into parts
-  if (pivot_idx > 0) {
-    int copy_len = (pivot_idx < 31) ? pivot_idx : 31;
-    memcpy(pre_pivot, word, copy_len);
-    pre_pivot[copy_len] = '\0';
-  }
-
-  pivot_char[0] = word[pivot_idx];
-  pivot_char[1] = '\0';
-
-  if (pivot_idx + 1 < word_length) {
-    int remaining = word_length - pivot_idx - 1;
-    int copy_len = (remaining < 31) ? remaining : 31;
-    memcpy(post_pivot, &word[pivot_idx + 1], copy_len);
-    post_pivot[copy_len] = '\0';
-  }
+  const char *pre_pivot = plan->parts;
+  const char *pivot_char = &plan->parts[plan->pivot_offset];
+  const char *post_pivot = &plan->parts[plan->post_offset];
 
   // Draw the three parts of the word
   int current_x = word_x;
@@ -517,7 +1029,7 @@ static void draw_rsvp_word(GContext *ctx, GRect bounds) {
     graphics_draw_text(ctx, pre_pivot, font, GRect(current_x, text_y, 200, 40),
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft,
                        NULL);
-    current_x += pre_pivot_width;
+    current_x += plan->pre_width;
   }
 
   // Part 2: Pivot letter (with bold effect for emphasis)
@@ -544,7 +1056,7 @@ static void draw_rsvp_word(GContext *ctx, GRect bounds) {
       ctx, pivot_char, font, GRect(current_x + 1, text_y + 1, 50, 40),
       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
 
-  current_x += pivot_char_width;
+  current_x += plan->pivot_width;
 
   // Part 3: Text after pivot (white)
   if (post_pivot[0] != '\0') {
@@ -553,33 +1065,6 @@ static void draw_rsvp_word(GContext *ctx, GRect bounds) {
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft,
                        NULL);
   }
-
-  // Draw navigation help at bottom in small font, left-aligned, 3 lines
-  GFont font_help = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-  graphics_context_set_text_color(ctx, GColorWhite);
-
-  // Build help text based on current mode (3 separate lines)
-  const char *help_line1 = "Arrows: navigation";
-  const char *help_line2;
-  const char *help_line3;
-
-  if (s_reading_article) {
-    help_line2 = "Select: stop";
-    help_line3 = "Back: title";
-  } else {
-    help_line2 = "Select: read";
-    help_line3 = "Back: menu";
-  }
-
-  graphics_draw_text(
-      ctx, help_line1, font_help, GRect(5, help_y, width - 10, 18),
-      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-  graphics_draw_text(
-      ctx, help_line2, font_help, GRect(5, help_y + 15, width - 10, 18),
-      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-  graphics_draw_text(
-      ctx, help_line3, font_help, GRect(5, help_y + 30, width - 10, 18),
-      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
 }
 
 // Draw END screen
@@ -597,6 +1082,77 @@ static void draw_end_screen(GContext *ctx, GRect bounds) {
                      NULL);
 }
 
+// Average render time per frame
+static int perf_render_avg_ms(void) {
+  return s_perf.render_count
+             ? (int)(s_perf.render_total_ms / s_perf.render_count)
+             : 0;
+}
+
+// Lowest free heap seen, 0 before the first frame
+static uint32_t perf_heap_min_free(void) {
+  return s_perf.heap_min_free == UINT32_MAX ? 0 : s_perf.heap_min_free;
+}
+
+// Backlight time of the session, counting the current interaction up to now
+static uint32_t perf_light_on_ms(void) {
+  if (!s_light_renewed) {
+    return s_perf.light_on_ms;
+  }
+  uint32_t on = now_ms() - s_light_renewed_ms;
+  return s_perf.light_on_ms +
+         (on < BACKLIGHT_TIMEOUT_MS ? on : BACKLIGHT_TIMEOUT_MS);
+}
+
+// Average lateness of timed events past their due time
+static int perf_event_late_avg_ms(void) {
+  return s_perf.events_run
+             ? (int)(s_perf.event_late_total_ms / s_perf.events_run)
+             : 0;
+}
+
+// Estimated energy used by the app's activity this session, in millijoules
+static uint32_t perf_energy_mj(void) {
+  uint32_t energy_uj = s_perf.wakeups * ENERGY_WAKEUP_UJ +
+                       s_perf.render_count * ENERGY_FRAME_UJ +
+                       (s_perf.msgs_in + s_perf.msgs_out) * ENERGY_MESSAGE_UJ +
+                       perf_light_on_ms() * ENERGY_LIGHT_UJ_PER_MS;
+  return energy_uj / 1000;
+}
+
+// Draw the diagnostics screen: a snapshot of the perf counters
+static void draw_diagnostics_screen(GContext *ctx, GRect bounds) {
+  graphics_context_set_fill_color(ctx, GColorBlack);
+  graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+  graphics_context_set_text_color(ctx, GColorWhite);
+
+  char text[320];
+  snprintf(text, sizeof(text),
+           "DIAGNOSTICS\n"
+           "Msgs in/out: %d/%d\n"
+           "Dropped/failed: %d/%d\n"
+           "Title timeouts: %d\n"
+           "Feed > title: %d ms\n"
+           "Select > word: %d ms\n"
+           "Render avg/max: %d/%d ms\n"
+           "Min free heap: %lu\n"
+           "Last WPM: %d (chunks +%d%%)\n"
+           "Wakeups %lu, late %d/%d ms\n"
+           "Light %lu s, ~%lu mJ",
+           s_perf.msgs_in, s_perf.msgs_out, s_perf.msgs_dropped,
+           s_perf.msgs_failed, s_perf.title_timeouts, s_perf.first_title_ms,
+           s_perf.first_word_ms,
+           perf_render_avg_ms(), s_perf.render_max_ms,
+           (unsigned long)perf_heap_min_free(), s_perf.last_wpm,
+           s_perf.chunk_gain_pct, (unsigned long)s_perf.wakeups,
+           perf_event_late_avg_ms(), s_perf.event_late_max_ms,
+           (unsigned long)(perf_light_on_ms() / 1000),
+           (unsigned long)perf_energy_mj());
+  graphics_draw_text(ctx, text, fonts_get_system_font(FONT_KEY_GOTHIC_14),
+                     GRect(4, 2, bounds.size.w - 8, bounds.size.h - 4),
+                     GTextOverflowModeWordWrap, GTextAlignmentLeft, NULL);
+}
+
 // Draw waiting for config screen
 static void draw_waiting_screen(GContext *ctx, GRect bounds) {
   int width = bounds.size.w;
@@ -634,7 +1190,8 @@ static void draw_loading_screen(GContext *ctx, GRect bounds) {
 
   // Show selected feed name
   if (selected_feed_index >= 0 && selected_feed_index < (int8_t)feed_count) {
-    graphics_draw_text(ctx, feed_names[selected_feed_index], font_title,
+    graphics_draw_text(ctx, pool_get(&s_feed_pool, selected_feed_index),
+                       font_title,
                        GRect(0, height / 2 - 35, width, 30),
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter,
                        NULL);
@@ -645,50 +1202,497 @@ static void draw_loading_screen(GContext *ctx, GRect bounds) {
       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
 }
 
+// True when the canvas shows the RSVP reader rather than another screen
+static bool is_rsvp_screen(void) {
+  return !s_showing_diagnostics && !s_waiting_for_config && !s_showing_menu &&
+         !(s_title_pool.count == 0 && selected_feed_index >= 0) &&
+         !s_end_screen;
+}
+
+// Force a full repaint of the chrome on the next frame
+static void invalidate_chrome(void) {
+  s_chrome_valid = false;
+  if (s_canvas_layer) {
+    layer_mark_dirty(s_canvas_layer);
+  }
+}
+
+// Redraw after a word change. Either mark redraws the whole layer tree; from
+// the word layer, the canvas proc skips the chrome unless it is stale.
+static void mark_word_dirty(void) {
+  if (s_chrome_valid && s_chrome_article_mode == s_reading_article) {
+    layer_mark_dirty(s_word_layer);
+  } else {
+    layer_mark_dirty(s_canvas_layer);
+  }
+}
+
 // Main update proc
-static void update_proc(Layer *layer, GContext *ctx) {
+static void draw_canvas(Layer *layer, GContext *ctx) {
   GRect bounds = layer_get_bounds(layer);
 
-  if (s_waiting_for_config) {
+  if (s_showing_diagnostics) {
+    draw_diagnostics_screen(ctx, bounds);
+  } else if (s_waiting_for_config) {
     draw_waiting_screen(ctx, bounds);
   } else if (s_showing_menu) {
     // Menu is shown separately
     return;
-  } else if (news_titles_count == 0 && selected_feed_index >= 0) {
+  } else if (s_title_pool.count == 0 && selected_feed_index >= 0) {
     // Waiting for news to load
     draw_loading_screen(ctx, bounds);
   } else if (s_end_screen) {
     draw_end_screen(ctx, bounds);
   } else {
-    draw_rsvp_word(ctx, bounds);
+    // The window background is GColorClear, so the frame buffer is not
+    // cleared and the chrome drawn earlier is still on screen; only the
+    // word band, which the word layer fills, changes between words. When
+    // another window or app was on top and overwrote the buffer, the appear
+    // and focus handlers have invalidated the chrome, and the full repaint
+    // here (its black fill covers the whole layer) leaves no stale pixels.
+    if (!s_chrome_valid || s_chrome_article_mode != s_reading_article) {
+      draw_rsvp_chrome(ctx, bounds);
+      s_chrome_valid = true;
+      s_chrome_article_mode = s_reading_article;
+    }
+    return;
   }
+  s_chrome_valid = false;
 }
 
-// Reset app state to restart from beginning
-static void reset_app_state(void) {
-  APP_LOG(APP_LOG_LEVEL_INFO, "Resetting app state");
+// Current time in milliseconds
+static uint32_t now_ms(void) {
+  time_t seconds;
+  uint16_t millis;
+  time_ms(&seconds, &millis);
+  return (uint32_t)seconds * 1000 + millis;
+}
 
-  // Cancel all timers
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-    rsvp_timer = NULL;
+// Count a frame's render time and sample the free heap
+static void perf_record_render(uint32_t start_ms) {
+  uint32_t elapsed = now_ms() - start_ms;
+  s_perf.render_total_ms += elapsed;
+  s_perf.render_count++;
+  if (elapsed > s_perf.render_max_ms) {
+    s_perf.render_max_ms = elapsed;
+  }
+  uint32_t heap_free = heap_bytes_free();
+  if (heap_free < s_perf.heap_min_free) {
+    s_perf.heap_min_free = heap_free;
+  }
+}
+
+// Keep the backlight on while reading if enabled. The interaction light is
+// renewed only when it is close to timing out, not for every word.
+static void hold_backlight(void) {
+  if (!s_backlight_enabled) {
+    return;
+  }
+  uint32_t now = now_ms();
+  if (s_light_renewed && now - s_light_renewed_ms < BACKLIGHT_RENEW_MS) {
+    return;
+  }
+  s_perf.light_on_ms = perf_light_on_ms();
+  light_enable_interaction();
+  s_light_renewed_ms = now;
+  s_light_renewed = true;
+  s_perf.light_renewals++;
+}
+
+// Delay for an event due in ms that may run up to WAKEUP_SLACK_MS late: the
+// next wakeup already planned when it falls in that window, so one wakeup
+// serves both
+static uint32_t coalesce_wakeup(uint32_t ms) {
+  if (!s_event_timer) {
+    return ms;
+  }
+  int32_t until_wakeup = (int32_t)(s_event_timer_due_ms - now_ms());
+  if (until_wakeup >= (int32_t)ms &&
+      until_wakeup <= (int32_t)(ms + WAKEUP_SLACK_MS)) {
+    return until_wakeup;
+  }
+  return ms;
+}
+
+// Whether heap entry a is due before entry b
+static bool event_before(uint8_t a, uint8_t b) {
+  return (int32_t)(s_event_heap[a].due_ms - s_event_heap[b].due_ms) < 0;
+}
+
+static void event_swap(uint8_t a, uint8_t b) {
+  ScheduledEvent event = s_event_heap[a];
+  s_event_heap[a] = s_event_heap[b];
+  s_event_heap[b] = event;
+}
+
+// Restore the heap order below entry i
+static void event_sift_down(uint8_t i) {
+  while (true) {
+    uint8_t first = i;
+    uint8_t left = 2 * i + 1;
+    uint8_t right = left + 1;
+    if (left < s_event_count && event_before(left, first)) {
+      first = left;
+    }
+    if (right < s_event_count && event_before(right, first)) {
+      first = right;
+    }
+    if (first == i) {
+      return;
+    }
+    event_swap(i, first);
+    i = first;
+  }
+}
+
+// Whether a heap entry is still the pending event of its type
+static bool event_current(const ScheduledEvent *event) {
+  return (s_events_pending & (1 << event->type)) &&
+         event->generation == s_event_generation[event->type];
+}
+
+// Remove the earliest entry
+static void event_pop(void) {
+  s_event_heap[0] = s_event_heap[--s_event_count];
+  event_sift_down(0);
+}
+
+// Drop outdated entries from the top of the heap
+static void event_drop_stale(void) {
+  while (s_event_count > 0 && !event_current(&s_event_heap[0])) {
+    event_pop();
+  }
+}
+
+static void event_timer_callback(void *context);
+
+// Arm the AppTimer for the earliest pending event, or stop it
+static void arm_event_timer(void) {
+  if (s_events_running) {
+    return;
+  }
+  event_drop_stale();
+  if (s_event_count == 0) {
+    if (s_event_timer) {
+      app_timer_cancel(s_event_timer);
+      s_event_timer = NULL;
+    }
+    return;
+  }
+  uint32_t due = s_event_heap[0].due_ms;
+  if (s_event_timer && due == s_event_timer_due_ms) {
+    return;
+  }
+  int32_t wait = (int32_t)(due - now_ms());
+  wait = wait > 0 ? wait : 1;
+  if (!s_event_timer || !app_timer_reschedule(s_event_timer, wait)) {
+    s_event_timer = app_timer_register(wait, event_timer_callback, NULL);
+  }
+  s_event_timer_due_ms = due;
+}
+
+// Schedule an event of a type in delay_ms, replacing any pending one
+static void schedule_event(EventType type, uint32_t delay_ms) {
+  s_event_generation[type]++;
+  s_events_pending |= 1 << type;
+
+  if (s_event_count == EVENT_HEAP_MAX) {
+    // Full of outdated entries: keep the current ones
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < s_event_count; i++) {
+      if (event_current(&s_event_heap[i])) {
+        s_event_heap[kept++] = s_event_heap[i];
+      }
+    }
+    s_event_count = kept;
+    for (int i = s_event_count / 2 - 1; i >= 0; i--) {
+      event_sift_down(i);
+    }
+  }
+
+  uint8_t i = s_event_count++;
+  s_event_heap[i] = (ScheduledEvent){
+      .due_ms = now_ms() + (delay_ms > 0 ? delay_ms : 1),
+      .type = type,
+      .generation = s_event_generation[type],
+  };
+  while (i > 0 && event_before(i, (i - 1) / 2)) {
+    event_swap(i, (i - 1) / 2);
+    i = (i - 1) / 2;
   }
-  if (rsvp_start_timer) {
-    app_timer_cancel(rsvp_start_timer);
-    rsvp_start_timer = NULL;
+  arm_event_timer();
+}
+
+// Cancel the pending event of a type; its heap entry becomes outdated
+static void cancel_event(EventType type) {
+  if (!(s_events_pending & (1 << type))) {
+    return;
   }
-  if (news_timer) {
-    app_timer_cancel(news_timer);
-    news_timer = NULL;
+  s_event_generation[type]++;
+  s_events_pending &= ~(1 << type);
+  arm_event_timer();
+}
+
+// Cancel every pending event and stop the timer
+static void cancel_all_events(void) {
+  for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+    s_event_generation[type]++;
   }
-  if (end_timer) {
-    app_timer_cancel(end_timer);
-    end_timer = NULL;
+  s_events_pending = 0;
+  s_event_count = 0;
+  arm_event_timer();
+}
+
+// Run the handler of a due event
+static void run_event(EventType type) {
+  switch (type) {
+  case EVENT_RSVP:
+    rsvp_timer_callback(NULL);
+    break;
+  case EVENT_RSVP_START:
+    rsvp_start_timer_callback(NULL);
+    break;
+  case EVENT_PAGE_NUMBER:
+    page_number_timer_callback(NULL);
+    break;
+  case EVENT_NEWS:
+    news_timer_callback(NULL);
+    break;
+  case EVENT_END:
+    end_timer_callback(NULL);
+    break;
+  default:
+    break;
+  }
+}
+
+// One wakeup: run every event that is due, in order, then re-arm for the
+// next. Events scheduled by a handler for later wait for their own wakeup.
+static void event_timer_callback(void *context) {
+  s_event_timer = NULL;
+  s_perf.wakeups++;
+
+  uint32_t now = now_ms();
+  s_events_running = true;
+  while (true) {
+    event_drop_stale();
+    if (s_event_count == 0 ||
+        (int32_t)(s_event_heap[0].due_ms - now) > 0) {
+      break;
+    }
+    ScheduledEvent event = s_event_heap[0];
+    event_pop();
+    s_events_pending &= ~(1 << event.type);
+
+    uint32_t late = now - event.due_ms;
+    s_perf.events_run++;
+    s_perf.event_late_total_ms += late;
+    if (late > s_perf.event_late_max_ms) {
+      s_perf.event_late_max_ms = late;
+    }
+    trace_event(event.type);
+    run_event(event.type);
   }
-  if (page_number_timer) {
-    app_timer_cancel(page_number_timer);
-    page_number_timer = NULL;
+  s_events_running = false;
+  arm_event_timer();
+}
+
+// Format the counters as one line
+static void format_perf_report(char *buffer, size_t size) {
+  snprintf(buffer, size,
+           "in %d out %d drop %d fail %d timeout %d title %dms word %dms "
+           "render %d/%dms heap %lu wpm %d chunk +%d%% wake %lu "
+           "late %d/%dms light %d/%lus energy %lumJ",
+           s_perf.msgs_in, s_perf.msgs_out, s_perf.msgs_dropped,
+           s_perf.msgs_failed, s_perf.title_timeouts, s_perf.first_title_ms,
+           s_perf.first_word_ms,
+           perf_render_avg_ms(), s_perf.render_max_ms,
+           (unsigned long)perf_heap_min_free(), s_perf.last_wpm,
+           s_perf.chunk_gain_pct, (unsigned long)s_perf.wakeups,
+           perf_event_late_avg_ms(), s_perf.event_late_max_ms,
+           s_perf.light_renewals, (unsigned long)(perf_light_on_ms() / 1000),
+           (unsigned long)perf_energy_mj());
+}
+
+// Log the counters and send them to the phone log, if the outbox is free.
+// False if they could not be sent.
+static bool send_perf_report(void) {
+  char report[PERF_REPORT_LEN];
+  format_perf_report(report, sizeof(report));
+  APP_LOG(APP_LOG_LEVEL_INFO, "Perf: %s", report);
+
+  DictionaryIterator *iter;
+  if (app_message_outbox_begin(&iter) != APP_MSG_OK) {
+    return false;
   }
+  dict_write_cstring(iter, KEY_PERF_REPORT, report);
+  app_message_outbox_send();
+  return true;
+}
+
+// Send the report a previous session saved when it closed, once the outbox
+// is free
+static void send_saved_perf_report(void) {
+  char report[PERF_REPORT_LEN];
+  DictionaryIterator *iter;
+  if (persist_read_string(PERSIST_KEY_PERF_REPORT, report, sizeof(report)) <=
+      0) {
+    s_perf_report_saved = false;
+    return;
+  }
+  if (app_message_outbox_begin(&iter) != APP_MSG_OK) {
+    return;
+  }
+  dict_write_cstring(iter, KEY_PERF_REPORT, report);
+  app_message_outbox_send();
+  persist_delete(PERSIST_KEY_PERF_REPORT);
+  s_perf_report_saved = false;
+}
+
+// Send the report and close the app
+static void exit_app(void) {
+  s_perf_reported = send_perf_report();
+  window_stack_pop(true);
+}
+
+// Full screen update proc. The word layer is its child, so on the reading
+// screen it is drawn next and closes the frame.
+static void update_proc(Layer *layer, GContext *ctx) {
+  s_frame_start_ms = now_ms();
+  draw_canvas(layer, ctx);
+  s_frame_open = is_rsvp_screen();
+  if (!s_frame_open) {
+    perf_record_render(s_frame_start_ms);
+  }
+}
+
+
+// Word layer update proc
+static void word_update_proc(Layer *layer, GContext *ctx) {
+  if (!is_rsvp_screen()) {
+    return;
+  }
+  draw_rsvp_word(ctx, layer_get_bounds(layer));
+  if (s_frame_open) {
+    s_frame_open = false;
+    perf_record_render(s_frame_start_ms);
+  }
+}
+
+// Forget the article stream and its word index
+static void reset_article_stream(void) {
+  s_article_stream_index = -1;
+  s_article_head = 0;
+  s_article_scan = 0;
+  s_article_in_word = false;
+  s_article_word_count = 0;
+  s_article_next_seq = 0;
+  s_article_done = false;
+  s_article_requested = false;
+  s_article_starved = false;
+}
+
+// Index of the article word on screen (0 until reading starts)
+static uint16_t article_read_index(void) {
+  return s_reading_article ? rsvp_word_index : 0;
+}
+
+// Record a word span of the article stream
+static void add_article_word(uint16_t start, uint16_t len) {
+  uint16_t slot = s_article_word_count & ARTICLE_WORD_MASK;
+  s_article_word_offsets[slot] = start;
+  s_article_word_lengths[slot] = (len > 255) ? 255 : len;
+  s_article_word_count++;
+}
+
+// Tokenize newly received article bytes. Resumable: stops when the word ring
+// is full and picks up again once the reader has consumed some words
+static void tokenize_article(void) {
+  while (s_article_scan != s_article_head &&
+         (uint16_t)(s_article_word_count - article_read_index()) <
+             ARTICLE_WORD_SLOTS) {
+    char c = s_article_ring[s_article_scan & ARTICLE_RING_MASK];
+    if (c == ' ' || c == '\t' || c == '\n') {
+      if (s_article_in_word) {
+        add_article_word(s_article_word_start,
+                         s_article_scan - s_article_word_start);
+        s_article_in_word = false;
+      }
+    } else if (!s_article_in_word) {
+      s_article_word_start = s_article_scan;
+      s_article_in_word = true;
+    } else if ((uint16_t)(s_article_scan - s_article_word_start) >=
+                   ARTICLE_WORD_MAX &&
+               ((uint8_t)c & 0xC0) != 0x80) {
+      // Split an over-long token (a URL, a run of symbols) at a character
+      // boundary so the ring behind it can be released
+      add_article_word(s_article_word_start,
+                       s_article_scan - s_article_word_start);
+      s_article_word_start = s_article_scan;
+    }
+    s_article_scan++;
+  }
+
+  // Handle last word
+  if (s_article_done && s_article_scan == s_article_head &&
+      s_article_in_word &&
+      (uint16_t)(s_article_word_count - article_read_index()) <
+          ARTICLE_WORD_SLOTS) {
+    add_article_word(s_article_word_start,
+                     s_article_scan - s_article_word_start);
+    s_article_in_word = false;
+  }
+}
+
+// Bytes of the ring that can be overwritten by the next chunk
+static uint16_t article_ring_free(void) {
+  // Everything before the word on screen has been read
+  uint16_t read_index = article_read_index();
+  uint16_t tail;
+  if (read_index < s_article_word_count) {
+    tail = s_article_word_offsets[read_index & ARTICLE_WORD_MASK];
+  } else {
+    tail = s_article_in_word ? s_article_word_start : s_article_scan;
+  }
+  return ARTICLE_RING_SIZE - (uint16_t)(s_article_head - tail);
+}
+
+// Ask JS for the next article chunk once the ring has room for it
+static void request_next_article_chunk(void) {
+  if (s_article_stream_index < 0 || s_article_done || s_article_requested ||
+      article_ring_free() < s_article_chunk_max) {
+    return;
+  }
+
+  // A prefetch only fetches the first chunk until the user asks to read
+  if (s_article_stream_index != s_article_news_index &&
+      s_article_next_seq > 0) {
+    return;
+  }
+
+  DictionaryIterator *iter;
+  AppMessageResult result = app_message_outbox_begin(&iter);
+  if (result == APP_MSG_OK) {
+    dict_write_uint8(iter, KEY_REQUEST_ARTICLE, s_article_stream_index);
+    dict_write_uint16(iter, KEY_ARTICLE_SEQ, s_article_next_seq);
+    if (s_article_stream_index == s_article_news_index) {
+      dict_write_uint8(iter, KEY_ARTICLE_URGENT, 1);
+    }
+    app_message_outbox_send();
+    s_article_requested = true;
+    APP_LOG(APP_LOG_LEVEL_INFO, "Article %d chunk %d requested",
+            s_article_stream_index, s_article_next_seq);
+  } else {
+    APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to begin outbox: %d", (int)result);
+  }
+}
+
+// Reset app state to restart from beginning
+static void reset_app_state(void) {
+  APP_LOG(APP_LOG_LEVEL_INFO, "Resetting app state");
+
+  // Cancel all timers
+  cancel_all_events();
 
   // Reset state variables
   news_title[0] = '\0';
@@ -696,9 +1700,15 @@ static void reset_app_state(void) {
   rsvp_word_index = 0;
   news_display_count = 0;
   news_retry_count = 0;
-  news_titles_count = 0;
+  pool_reset(&s_title_pool);
   current_news_index = -1;
   selected_feed_index = -1;
+  s_news_complete = false;
+  s_news_expected_seq = 0;
+  s_news_ack_pending = false;
+  s_titles_from_cache = false;
+  s_refreshing_cache = false;
+  s_refresh_match_pending = false;
   s_splash_active = false;
   s_end_screen = false;
   s_paused = false;
@@ -708,172 +1718,283 @@ static void reset_app_state(void) {
   s_article_news_index = -1;
   s_showing_page_number = false;
   s_user_navigating = false;
-  news_article[0] = '\0';
+  reset_article_stream();
 
   // Show the journal menu
   show_journal_menu();
 }
 
-// Request news from JS
-static void request_news_from_js(void) {
-  APP_LOG(APP_LOG_LEVEL_INFO, "Requesting news from JS");
-  DictionaryIterator *iter;
-  AppMessageResult result = app_message_outbox_begin(&iter);
-  if (result == APP_MSG_OK) {
-    dict_write_uint8(iter, KEY_REQUEST_NEWS, 1);
-    app_message_outbox_send();
-    APP_LOG(APP_LOG_LEVEL_INFO, "News request sent");
-  } else {
-    APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to begin outbox: %d", (int)result);
+// Whether more titles should be requested: fetching stops once the user
+// navigates, except while fresh titles are replacing the cached ones
+static bool titles_wanted(void) {
+  return s_title_pool.count < news_max_count && !s_news_complete &&
+         (!s_user_navigating || s_refreshing_cache);
+}
+
+// The user took over navigation: stop fetching titles if allowed
+static void stop_title_fetch(void) {
+  s_user_navigating = true;
+  if (!s_refreshing_cache) {
+    cancel_event(EVENT_NEWS);
+  }
+}
+
+// Acknowledge the title batches received so far and open the window for
+// the next ones, closed once titles are no longer wanted. Retried shortly if
+// the outbox is busy (e.g. with an article prefetch); once sent, the
+// watchdog waits for the next batch.
+static void ack_news_batches(void) {
+  cancel_event(EVENT_NEWS);
+
+  DictionaryIterator *iter;
+  s_news_ack_pending = app_message_outbox_begin(&iter) != APP_MSG_OK;
+  if (s_news_ack_pending) {
+    schedule_event(EVENT_NEWS, coalesce_wakeup(100));
+    return;
+  }
+  bool wanted = titles_wanted();
+  dict_write_uint16(iter, KEY_NEWS_ACK, s_news_expected_seq);
+  dict_write_uint8(iter, KEY_NEWS_WINDOW, wanted ? NEWS_WINDOW : 0);
+  app_message_outbox_send();
+  APP_LOG(APP_LOG_LEVEL_INFO, "Acked title batch %d, window %d",
+          s_news_expected_seq, wanted ? NEWS_WINDOW : 0);
+
+  if (wanted) {
+    schedule_event(EVENT_NEWS, coalesce_wakeup(NEWS_WATCHDOG_MS));
+  }
+}
+
+// Start streaming the article of a headline unless it is already in the ring
+static void prefetch_article(int8_t index) {
+  // Positions in the cached list may not match the phone's fresh one
+  if (s_titles_from_cache || s_refresh_match_pending) {
+    return;
+  }
+  if (index < 0 || index == s_article_stream_index) {
+    // Retry a first request that found the outbox busy
+    request_next_article_chunk();
+    return;
+  }
+  reset_article_stream();
+  s_article_stream_index = index;
+  request_next_article_chunk();
+}
+
+// Copy word i of the current text (title or article) into buffer
+static bool copy_word(uint16_t i, char *buffer, size_t size) {
+  if (s_reading_article) {
+    if (i >= s_article_word_count) {
+      buffer[0] = '\0';
+      return false;
+    }
+
+    uint16_t slot = i & ARTICLE_WORD_MASK;
+    uint16_t offset = s_article_word_offsets[slot];
+    uint16_t word_len = s_article_word_lengths[slot];
+    if (word_len > size - 1) {
+      word_len = size - 1;
+    }
+
+    // Copy in at most two pieces when the word wraps around the ring
+    uint16_t start = offset & ARTICLE_RING_MASK;
+    uint16_t first = ARTICLE_RING_SIZE - start;
+    if (first > word_len) {
+      first = word_len;
+    }
+    memcpy(buffer, &s_article_ring[start], first);
+    memcpy(&buffer[first], s_article_ring, word_len - first);
+    buffer[word_len] = '\0';
+    return true;
   }
+
+  return copy_indexed_word(&s_title_words, i, buffer, size);
 }
 
-// Request article for current news index from JS
-static void request_article_from_js(uint8_t index) {
-  APP_LOG(APP_LOG_LEVEL_INFO, "Requesting article %d from JS", index);
-  DictionaryIterator *iter;
-  AppMessageResult result = app_message_outbox_begin(&iter);
-  if (result == APP_MSG_OK) {
-    dict_write_uint8(iter, KEY_REQUEST_ARTICLE, index);
-    app_message_outbox_send();
-    APP_LOG(APP_LOG_LEVEL_INFO, "Article request sent for index %d", index);
-  } else {
-    APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to begin outbox: %d", (int)result);
-  }
+// Whether a chunk fits s_chunk_width when centered on its pivot letter, the
+// way draw_rsvp_word places it
+static bool chunk_fits(const char *chunk, int length, GFont font) {
+  int pivot = get_text_pivot_index(chunk, length);
+  int half = s_chunk_width / 2;
+  int left = get_text_width(chunk, pivot, font);
+  int right = get_text_width(&chunk[pivot], length - pivot, font);
+  return left <= half && right <= half;
 }
 
-// Extract next word from the current text (title or article)
+// Extract the next flash into rsvp_word: the word at rsvp_word_index and, in
+// chunk mode, the words after it while each one before is short and the
+// group fits the chunk width
 static bool extract_next_word(void) {
-  // Use article if reading article, otherwise use title
-  const char *p = s_reading_article ? news_article : news_title;
-
-  // Safety check: ensure we have valid text
-  if (!p || p[0] == '\0') {
-    rsvp_word[0] = '\0';
+  if (s_reading_article) {
+    tokenize_article();
+  }
+  s_chunk_words = 0;
+  s_chunk_last = 0;
+  if (!copy_word(rsvp_word_index, rsvp_word, sizeof(rsvp_word))) {
     return false;
   }
+  s_chunk_words = 1;
+  s_chunk_single_ms =
+      calculate_word_delay(&s_pacing_model, rsvp_word, rsvp_wpm_ms);
+  if (s_chunk_width == 0) {
+    return true;
+  }
 
-  uint16_t word_count = 0;
-  uint16_t word_start = 0;
-  uint16_t word_len = 0;
-  uint16_t i = 0;
-  bool in_word = false;
-
-  while (p[i] != '\0' && i < 1000) { // Safety limit to prevent infinite loop
-    if (p[i] == ' ' || p[i] == '\t' || p[i] == '\n') {
-      if (in_word) {
-        if (word_count == rsvp_word_index) {
-          if (word_len > sizeof(rsvp_word) - 1) {
-            word_len = sizeof(rsvp_word) - 1;
-          }
-          memcpy(rsvp_word, &p[word_start], word_len);
-          rsvp_word[word_len] = '\0';
-          return true;
-        }
-        word_count++;
-        in_word = false;
-      }
-    } else {
-      if (!in_word) {
-        word_start = i;
-        word_len = 0;
-        in_word = true;
-      }
-      word_len++;
+  GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_28);
+  uint16_t length = strlen(rsvp_word);
+  char word[sizeof(rsvp_word)];
+  while (s_chunk_words < CHUNK_MAX_WORDS &&
+         word_leads_chunk(&rsvp_word[s_chunk_last], length - s_chunk_last) &&
+         copy_word(rsvp_word_index + s_chunk_words, word, sizeof(word))) {
+    uint16_t word_len = strlen(word);
+    if ((size_t)(length + 1 + word_len) >= sizeof(rsvp_word)) {
+      break;
     }
-    i++;
+    rsvp_word[length] = ' ';
+    memcpy(&rsvp_word[length + 1], word, word_len + 1);
+    if (!chunk_fits(rsvp_word, length + 1 + word_len, font)) {
+      rsvp_word[length] = '\0';
+      break;
+    }
+    s_chunk_last = length + 1;
+    length += 1 + word_len;
+    s_chunk_words++;
+    s_chunk_single_ms +=
+        calculate_word_delay(&s_pacing_model, word, rsvp_wpm_ms);
   }
+  return true;
+}
 
-  // Handle last word
-  if (in_word && word_count == rsvp_word_index) {
-    if (word_len > sizeof(rsvp_word) - 1) {
-      word_len = sizeof(rsvp_word) - 1;
+// Start pacing a text from the word now on screen
+static void start_word_pacing(void) {
+  s_pacing_start_ms = now_ms();
+  s_word_deadline_ms = s_pacing_start_ms;
+  s_pacing_target_ms = 0;
+  s_pacing_single_ms = 0;
+  s_pacing_stall_ms = 0;
+  s_jitter_sum_ms = 0;
+  s_jitter_max_ms = 0;
+  s_pacing_words = 0;
+  s_pacing_flashes = 0;
+}
+
+// Arm the word timer for the deadline of the flash now on screen. A flash
+// shown late gets a shorter wait so the text catches up; after a stall
+// longer than the flash's own delay (waiting for a chunk) pacing restarts
+// from now instead of rushing.
+static void schedule_next_word(void) {
+  uint32_t now = now_ms();
+  uint16_t delay = calculate_chunk_delay(
+      &s_pacing_model, &rsvp_word[s_chunk_last], s_chunk_words, rsvp_wpm_ms);
+  pacing_add_word(&s_pacing_model, &rsvp_word[s_chunk_last], rsvp_wpm_ms);
+
+  int32_t late = (int32_t)(now - s_word_deadline_ms);
+  if (late > delay) {
+    s_pacing_stall_ms += late;
+    s_word_deadline_ms = now;
+  } else if (late > 0) {
+    s_jitter_sum_ms += late;
+    if (late > s_jitter_max_ms) {
+      s_jitter_max_ms = late;
     }
-    memcpy(rsvp_word, &p[word_start], word_len);
-    rsvp_word[word_len] = '\0';
-    return true;
   }
 
-  return false;
+  s_word_deadline_ms += delay;
+  s_pacing_target_ms += delay;
+  s_pacing_single_ms += s_chunk_single_ms;
+  s_pacing_words += s_chunk_words;
+  s_pacing_flashes++;
+
+  int32_t wait = (int32_t)(s_word_deadline_ms - now);
+  schedule_event(EVENT_RSVP, wait > 0 ? wait : 1);
 }
 
-// Forward declarations
-static void news_timer_callback(void *context);
-static void rsvp_timer_callback(void *context);
-static void rsvp_start_timer_callback(void *context);
-static void page_number_timer_callback(void *context);
+// Log achieved against target WPM, the gain from chunking (target time of
+// the same words one per flash over the chunked one) and flash jitter for
+// the text just read
+static void log_word_pacing(const char *what) {
+  uint32_t elapsed = now_ms() - s_pacing_start_ms - s_pacing_stall_ms;
+  if (s_pacing_words == 0 || elapsed == 0 || s_pacing_target_ms == 0) {
+    return;
+  }
+  s_perf.last_wpm = (uint32_t)s_pacing_words * 60000 / elapsed;
+  s_perf.chunk_gain_pct = s_pacing_single_ms * 100 / s_pacing_target_ms - 100;
+  APP_LOG(APP_LOG_LEVEL_INFO,
+          "%s pacing: %d words in %d flashes, %d WPM achieved / %d target "
+          "(base %d, chunks +%d%%), jitter avg %d ms max %d ms, stalled %d ms",
+          what, s_pacing_words, s_pacing_flashes, s_perf.last_wpm,
+          (int)((uint32_t)s_pacing_words * 60000 / s_pacing_target_ms),
+          60000 / rsvp_wpm_ms, s_perf.chunk_gain_pct,
+          (int)(s_jitter_sum_ms / s_pacing_flashes), s_jitter_max_ms,
+          (int)s_pacing_stall_ms);
+}
 
 // Page number timer callback - shows page number as word after 500ms pause
 static void page_number_timer_callback(void *context) {
-  page_number_timer = NULL;
 
   // Display page number as a word (only for titles, not articles)
-  if (!s_reading_article && news_titles_count > 0 && current_news_index >= 0) {
+  if (!s_reading_article && s_title_pool.count > 0 && current_news_index >= 0) {
     snprintf(rsvp_word, sizeof(rsvp_word), "%d/%d", current_news_index + 1,
-             news_titles_count);
+             s_title_pool.count);
     s_showing_page_number = true;
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
   }
 }
 
 // RSVP start timer callback - called after 2 seconds to start showing words
 static void rsvp_start_timer_callback(void *context) {
-  rsvp_start_timer = NULL;
 
   // Show the first word
-  layer_mark_dirty(s_canvas_layer);
+  mark_word_dirty();
 
   // Start the RSVP word timer with Spritz-style delay
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-  }
-  uint16_t delay = calculate_spritz_delay(rsvp_word);
-  rsvp_timer = app_timer_register(delay, rsvp_timer_callback, NULL);
+  start_word_pacing();
+  schedule_next_word();
 }
 
 // End timer callback - closes the app after 2 seconds
 static void end_timer_callback(void *context) {
-  end_timer = NULL;
-  window_stack_pop(true);
+  exit_app();
 }
 
 // Start RSVP display for current news_title
 static void start_rsvp_for_title(void) {
   APP_LOG(APP_LOG_LEVEL_INFO, "Starting RSVP for title");
+
+  // Time from feed selection to the first title
+  if (s_feed_select_time_ms != 0) {
+    s_perf.first_title_ms = now_ms() - s_feed_select_time_ms;
+    s_feed_select_time_ms = 0;
+  }
+
+  index_words(&s_title_words, news_title);
   rsvp_word_index = 0;
+  pacing_reset(&s_pacing_model);
   s_showing_page_number = false;
   if (extract_next_word()) {
     APP_LOG(APP_LOG_LEVEL_INFO, "First word: %s", rsvp_word);
 
     // Cancel any existing timers
-    if (rsvp_timer) {
-      app_timer_cancel(rsvp_timer);
-      rsvp_timer = NULL;
-    }
-    if (rsvp_start_timer) {
-      app_timer_cancel(rsvp_start_timer);
-      rsvp_start_timer = NULL;
-    }
+    cancel_event(EVENT_RSVP);
+    cancel_event(EVENT_RSVP_START);
 
-    // Enable backlight for reading if option is enabled
-    if (s_backlight_enabled) {
-      light_enable_interaction();
-    }
+    hold_backlight();
 
     // On first news after splash, start immediately without help screen
     // On subsequent news (after navigation), also start immediately
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
 
     if (s_first_news_after_splash) {
       // First news: small delay before showing words
-      rsvp_start_timer =
-          app_timer_register(500, rsvp_start_timer_callback, NULL);
+      schedule_event(EVENT_RSVP_START, 500);
       s_first_news_after_splash = false; // Clear flag after first use
     } else {
       // Instant display for button navigation
-      uint16_t delay = calculate_spritz_delay(rsvp_word);
-      rsvp_timer = app_timer_register(delay, rsvp_timer_callback, NULL);
+      start_word_pacing();
+      schedule_next_word();
     }
+
+    // Fetch the article while the title is being read
+    prefetch_article(current_news_index);
   } else {
     APP_LOG(APP_LOG_LEVEL_WARNING, "Failed to extract first word");
   }
@@ -882,70 +2003,71 @@ static void start_rsvp_for_title(void) {
 // Show splash and then go to next title after article reading
 static void show_splash_then_next_title(void) {
   // Cancel any existing timers
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-    rsvp_timer = NULL;
-  }
-  if (rsvp_start_timer) {
-    app_timer_cancel(rsvp_start_timer);
-    rsvp_start_timer = NULL;
-  }
-  if (page_number_timer) {
-    app_timer_cancel(page_number_timer);
-    page_number_timer = NULL;
-  }
+  cancel_event(EVENT_RSVP);
+  cancel_event(EVENT_RSVP_START);
+  cancel_event(EVENT_PAGE_NUMBER);
 
   // Clear article mode
   s_reading_article = false;
   s_showing_page_number = false;
-  news_article[0] = '\0';
+  reset_article_stream();
   rsvp_word[0] = '\0';
 
   // Stay on the same title (don't increment)
   current_news_index = s_article_news_index;
   s_article_news_index = -1;
   snprintf(news_title, sizeof(news_title), "%s",
-           news_titles[current_news_index]);
+           pool_get(&s_title_pool, current_news_index));
 
   // Don't start reading - just show the page number after a pause
   rsvp_word[0] = '\0';
-  layer_mark_dirty(s_canvas_layer);
+  mark_word_dirty();
 
   // Show page number after 500ms pause
-  if (page_number_timer) {
-    app_timer_cancel(page_number_timer);
-  }
-  page_number_timer = app_timer_register(500, page_number_timer_callback, NULL);
+  schedule_event(EVENT_PAGE_NUMBER, 500);
+
+  // Have the article ready again in case the user re-reads it
+  prefetch_article(current_news_index);
 }
 
-// Start reading the article content
+// Start reading the article content as soon as its first word has arrived
 static void start_article_reading(void) {
-  if (news_article[0] == '\0') {
-    APP_LOG(APP_LOG_LEVEL_WARNING, "No article content to read");
+  rsvp_word_index = 0;
+  pacing_reset(&s_pacing_model);
+  tokenize_article();
+  if (s_article_word_count == 0) {
+    if (s_article_done) {
+      APP_LOG(APP_LOG_LEVEL_WARNING, "No article content to read");
+    }
     return;
   }
 
   APP_LOG(APP_LOG_LEVEL_INFO, "Starting article reading");
   s_reading_article = true;
-  rsvp_word_index = 0;
 
-  // Enable backlight for reading if option is enabled
-  if (s_backlight_enabled) {
-    light_enable_interaction();
+  // Time from Select to the first article word
+  if (s_select_time_ms != 0) {
+    s_perf.first_word_ms = now_ms() - s_select_time_ms;
+    APP_LOG(APP_LOG_LEVEL_INFO,
+            "Time to first article word: %d ms (prefetch hits %d, misses %d)",
+            s_perf.first_word_ms, s_prefetch_hits,
+            s_prefetch_misses);
+    s_select_time_ms = 0;
   }
 
+  hold_backlight();
+
   if (extract_next_word()) {
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
 
     // Start the timer
-    uint16_t delay = calculate_spritz_delay(rsvp_word);
-    rsvp_timer = app_timer_register(delay, rsvp_timer_callback, NULL);
+    start_word_pacing();
+    schedule_next_word();
   }
 }
 
 // RSVP timer callback
 static void rsvp_timer_callback(void *context) {
-  rsvp_timer = NULL;
 
   if (s_paused || s_end_screen) {
     return;
@@ -958,176 +2080,339 @@ static void rsvp_timer_callback(void *context) {
   }
 #endif
 
-  // Keep backlight on during reading if option is enabled
-  if (s_backlight_enabled) {
-    light_enable_interaction();
-  }
+  hold_backlight();
 
-  rsvp_word_index++;
+  uint8_t shown = s_chunk_words;
+  rsvp_word_index += shown;
   if (extract_next_word()) {
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
     // Calculate Spritz-style variable delay based on word characteristics
-    uint16_t delay = calculate_spritz_delay(rsvp_word);
-    rsvp_timer = app_timer_register(delay, rsvp_timer_callback, NULL);
+    schedule_next_word();
+    if (s_reading_article) {
+      request_next_article_chunk();
+    }
+  } else if (s_reading_article && !s_article_done) {
+    // Reader caught up with the stream: keep the current word on screen
+    // until the next chunk arrives
+    rsvp_word_index -= shown;
+    extract_next_word();
+    if (!s_article_starved) {
+      APP_LOG(APP_LOG_LEVEL_INFO, "Waiting for article chunk %d",
+              s_article_next_seq);
+    }
+    s_article_starved = true;
+    request_next_article_chunk();
+    // Tick again while waiting: the request may have found the outbox busy
+    // or failed, and no word tick would retry it
+    schedule_event(EVENT_RSVP, ARTICLE_RETRY_MS);
   } else {
     // End of text
+    log_word_pacing(s_reading_article ? "Article" : "Title");
     rsvp_word[0] = '\0';
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
 
     if (s_reading_article) {
       // End of article - show splash then go to next title
       show_splash_then_next_title();
     } else {
       // End of title - stop automatic news fetching and show page number
-      s_user_navigating = true;
-      if (news_timer) {
-        app_timer_cancel(news_timer);
-        news_timer = NULL;
-      }
+      stop_title_fetch();
 
       // Show page number after 500ms pause
-      if (page_number_timer) {
-        app_timer_cancel(page_number_timer);
-      }
-      page_number_timer =
-          app_timer_register(500, page_number_timer_callback, NULL);
+      schedule_event(EVENT_PAGE_NUMBER, 500);
+
+      // Retry the prefetch if the outbox was busy when the title started
+      prefetch_article(current_news_index);
     }
   }
 }
 
-// News timer callback
+// News timer callback: sends a pending ack, or is the watchdog that fired
+// because no batch arrived in time
 static void news_timer_callback(void *context) {
-  news_timer = NULL;
 
   if (s_paused) {
     return;
   }
 
-  // Stop if user is manually navigating
-  if (s_user_navigating) {
-    return;
+  if (!s_news_ack_pending) {
+    // Stop if user is manually navigating or we have all the news we need
+    if (!titles_wanted()) {
+      return;
+    }
+
+    // Check retry limit
+    if (news_retry_count >= news_max_retries) {
+      // If we have at least some news, just stop requesting more
+      if (s_title_pool.count > 0) {
+        news_retry_count = 0;
+        return;
+      }
+      // No news at all - show error
+      s_end_screen = true;
+      s_paused = true;
+      layer_mark_dirty(s_canvas_layer);
+      news_retry_count = 0;
+      schedule_event(EVENT_END, 1000);
+      return;
+    }
+    news_retry_count++;
+    s_perf.title_timeouts++;
   }
 
-  // Check if we already have all the news we need
-  if (news_titles_count >= news_max_count) {
+  // Repeat the ack: JS resends from the batch expected, or retries loading
+  // the feed if it has nothing to send
+  ack_news_batches();
+}
+
+// Append an article chunk to the ring and start or resume reading
+static void store_article_chunk(int index, uint16_t seq, bool done,
+                                const uint8_t *data, uint16_t length) {
+  if (index < 0 || index != s_article_stream_index ||
+      seq != s_article_next_seq) {
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Ignoring article %d chunk %d", index,
+            seq);
     return;
   }
+  s_article_requested = false;
 
-  // Check retry limit
-  if (news_retry_count >= news_max_retries) {
-    // If we have at least some news, just stop requesting more
-    if (news_titles_count > 0) {
-      news_retry_count = 0;
-      return;
-    }
-    // No news at all - show error
-    s_end_screen = true;
-    s_paused = true;
-    layer_mark_dirty(s_canvas_layer);
-    news_retry_count = 0;
-    end_timer = app_timer_register(1000, end_timer_callback, NULL);
+  // A chunk unpacks to at most s_article_chunk_max bytes, which the ring had
+  // room for when it was requested
+  if (article_ring_free() < s_article_chunk_max) {
+    APP_LOG(APP_LOG_LEVEL_ERROR, "Article chunk %d overflows ring", seq);
+    request_next_article_chunk();
     return;
   }
 
-  // Request next news
-  news_retry_count++;
-  request_news_from_js();
-  // Safety timeout
-  news_timer = app_timer_register(8000, news_timer_callback, NULL);
+  // Unpack straight into the ring, wrapping around its end
+  uint16_t unpacked = unpack_text(data, length, s_article_ring, s_article_head,
+                                  ARTICLE_RING_MASK, s_article_chunk_max);
+  s_article_head += unpacked;
+  s_article_next_seq++;
+  s_article_done = done;
+  APP_LOG(APP_LOG_LEVEL_INFO,
+          "Received article chunk %d (%d bytes, %d packed)%s", seq, unpacked,
+          length, done ? ", last" : "");
+
+  if (!s_reading_article) {
+    // Start reading on the first chunk if the user is waiting for it,
+    // otherwise keep it as a prefetch
+    if (s_article_news_index == s_article_stream_index) {
+      start_article_reading();
+    }
+  } else if (s_article_starved) {
+    // Resume right where the reader stalled
+    s_article_starved = false;
+    rsvp_timer_callback(NULL);
+  }
+  request_next_article_chunk();
 }
 
-// Message received callback
-static void inbox_received_callback(DictionaryIterator *iterator,
-                                    void *context) {
-  APP_LOG(APP_LOG_LEVEL_INFO, "Received message from JS");
-
-  // Handle feeds count
-  Tuple *feeds_count_tuple = dict_find(iterator, KEY_FEEDS_COUNT);
-  if (feeds_count_tuple) {
-    feed_count = feeds_count_tuple->value->uint8;
-    APP_LOG(APP_LOG_LEVEL_INFO, "Received feeds count: %d", feed_count);
-    if (feed_count > 20)
-      feed_count = 20;
-    // Reset feed names array
-    for (int i = 0; i < 20; i++) {
-      feed_names[i][0] = '\0';
+// Fresh titles are replacing the cached ones: follow the headline on screen
+// to its new position, and move to a fresh one if it left the feed
+static void follow_refreshed_title(uint8_t first_new) {
+  for (uint8_t i = first_new; s_refresh_match_pending && i < s_title_pool.count;
+       i++) {
+    if (strcmp(pool_get(&s_title_pool, i), news_title) == 0) {
+      s_refresh_match_pending = false;
+      if (s_article_news_index == current_news_index) {
+        s_article_news_index = i; // Select is waiting for this article
+      }
+      current_news_index = i;
+      prefetch_article(current_news_index);
     }
-    // Reload menu if visible
-    if (s_showing_menu && s_menu_layer) {
-      menu_layer_reload_data(s_menu_layer);
+  }
+
+  if (s_news_complete) {
+    s_refreshing_cache = false;
+    if (s_refresh_match_pending && s_title_pool.count > 0) {
+      display_news_at_index(current_news_index);
     }
+    s_refresh_match_pending = false;
+  }
+}
+
+// Unpack a KEY_NEWS_TITLES batch: each title is a length byte followed by its
+// packed bytes, and a zero length marks the end of the feed
+static void store_news_titles(uint16_t seq, const uint8_t *data,
+                              uint16_t length) {
+  if (seq != s_news_expected_seq) {
+    // Duplicate, or one went missing: repeat the ack so JS resends from the
+    // batch expected
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Ignoring title batch %d, expecting %d",
+            seq, s_news_expected_seq);
+    ack_news_batches();
     return;
   }
+  s_news_expected_seq++;
+  news_retry_count = 0;
 
-  // Handle feed name
-  Tuple *feed_name_tuple = dict_find(iterator, KEY_FEED_NAME);
-  if (feed_name_tuple && feed_name_tuple->value &&
-      feed_name_tuple->value->cstring) {
-    // Find first empty slot
-    for (int i = 0; i < feed_count && i < 20; i++) {
-      if (feed_names[i][0] == '\0') {
-        snprintf(feed_names[i], sizeof(feed_names[0]), "%s",
-                 feed_name_tuple->value->cstring);
-        APP_LOG(APP_LOG_LEVEL_INFO, "Received feed name %d: %s", i,
-                feed_names[i]);
-        break;
-      }
+  cancel_event(EVENT_NEWS);
+
+  // The first fresh batch replaces the cached titles; the title on screen
+  // keeps playing from its copy in news_title
+  bool replacing_cache = s_titles_from_cache;
+  if (replacing_cache) {
+    s_titles_from_cache = false;
+    s_refreshing_cache = true;
+    s_refresh_match_pending = current_news_index >= 0;
+    pool_reset(&s_title_pool);
+  }
+
+  uint8_t first_new = s_title_pool.count;
+  uint16_t unpacked_bytes = 0;
+  uint16_t pos = 0;
+  while (pos < length) {
+    uint8_t title_len = data[pos++];
+    if (title_len == 0) {
+      s_news_complete = true;
+      break;
     }
-    // Reload menu if visible
-    if (s_showing_menu && s_menu_layer) {
-      menu_layer_reload_data(s_menu_layer);
+    if (pos + title_len > length) {
+      APP_LOG(APP_LOG_LEVEL_WARNING, "Truncated title batch");
+      break;
     }
-    return;
+
+    // Unpack the title and store it in the pool
+    char title[MAX_TITLE_LEN];
+    uint16_t title_bytes = unpack_text(&data[pos], title_len, title, 0, 0xFFFF,
+                                       MAX_TITLE_LEN);
+    unpacked_bytes += title_bytes;
+    if (!pool_add(&s_title_pool, title, title_bytes)) {
+      APP_LOG(APP_LOG_LEVEL_WARNING, "Title pool full");
+      s_news_complete = true;
+      break;
+    }
+    pos += title_len;
   }
 
-  // Handle article content
-  Tuple *article_tuple = dict_find(iterator, KEY_NEWS_ARTICLE);
-  if (article_tuple && article_tuple->value && article_tuple->value->cstring) {
-    snprintf(news_article, sizeof(news_article), "%s",
-             article_tuple->value->cstring);
-    APP_LOG(APP_LOG_LEVEL_INFO, "Received article (%d chars)",
-            (int)strlen(news_article));
-
-    // Start reading the article
-    start_article_reading();
-    return; // Don't process other messages
+  APP_LOG(APP_LOG_LEVEL_INFO,
+          "Stored news %d-%d, total: %d (%d bytes, %d packed)%s", first_new,
+          s_title_pool.count - 1, s_title_pool.count, unpacked_bytes, length,
+          s_news_complete ? " (end of feed)" : "");
+  pool_log(&s_title_pool, "Title");
+
+  if (replacing_cache && current_news_index >= s_title_pool.count) {
+    current_news_index = s_title_pool.count - 1;
+  }
+  if (s_refreshing_cache) {
+    follow_refreshed_title(first_new);
+  }
+
+  // Cache the complete feed for the next launch
+  if (s_news_complete) {
+    pool_persist(&s_title_pool, PERSIST_KEY_TITLE_CACHE, TITLE_CACHE_CHUNKS,
+                 hash_string(pool_get(&s_feed_pool, selected_feed_index)));
   }
 
-  Tuple *news_title_tuple = dict_find(iterator, KEY_NEWS_TITLE);
-  if (news_title_tuple && news_title_tuple->value &&
-      news_title_tuple->value->cstring) {
+  // If this is the first news, start displaying it
+  if (first_new == 0 && s_title_pool.count > 0 && !replacing_cache) {
+    current_news_index = 0;
     snprintf(news_title, sizeof(news_title), "%s",
-             news_title_tuple->value->cstring);
-    APP_LOG(APP_LOG_LEVEL_INFO, "Received title: %s", news_title);
-    news_retry_count = 0;
+             pool_get(&s_title_pool, 0));
+    start_rsvp_for_title();
+  }
+
+  // Acknowledge the batch; the window stays open while titles are wanted
+  ack_news_batches();
+}
+
+// Ask JS for the feed list; retried after the next send if the outbox is busy
+static void request_feed_list(void) {
+  DictionaryIterator *iter;
+  if (app_message_outbox_begin(&iter) != APP_MSG_OK) {
+    s_feed_list_stale = true;
+    return;
+  }
+  s_feed_list_stale = false;
+  dict_write_uint8(iter, KEY_REQUEST_FEEDS, 1);
+  app_message_outbox_send();
+  APP_LOG(APP_LOG_LEVEL_INFO, "Feed list request sent");
+}
 
-    if (news_timer) {
-      app_timer_cancel(news_timer);
-      news_timer = NULL;
+// Replace the feed list with the names JS sent and cache it under their hash,
+// so the next launch shows it at once and JS only resends it when it changes
+static void store_feed_list(uint32_t hash, const uint8_t *data,
+                            uint16_t length) {
+  pool_reset(&s_feed_pool);
+  uint16_t start = 0;
+  for (uint16_t i = 0; i < length; i++) {
+    if (data[i] != '\0') {
+      continue;
     }
+    uint16_t name_len = i - start;
+    if (name_len > MAX_FEED_NAME_LEN) {
+      name_len = MAX_FEED_NAME_LEN;
+    }
+    if (!pool_add(&s_feed_pool, (const char *)&data[start], name_len)) {
+      break;
+    }
+    start = i + 1;
+  }
+  feed_count = s_feed_pool.count;
+  s_feed_list_hash = hash;
+  pool_log(&s_feed_pool, "Feed");
+  pool_persist(&s_feed_pool, PERSIST_KEY_FEED_CACHE, FEED_CACHE_CHUNKS, hash);
+}
 
-    // Store the title in our array
-    if (news_titles_count < 50) {
-      snprintf(news_titles[news_titles_count], sizeof(news_titles[0]), "%s",
-               news_title);
-      news_titles_count++;
-      APP_LOG(APP_LOG_LEVEL_INFO, "Stored news %d, total: %d",
-              news_titles_count - 1, news_titles_count);
-
-      // If this is the first news, start displaying it
-      if (news_titles_count == 1) {
-        current_news_index = 0;
-        start_rsvp_for_title();
-      }
+// Set the chunk width, capped to the guide lines (0 = one word per flash)
+static void set_chunk_width(uint8_t width) {
+  s_chunk_width = width > CHUNK_WIDTH_MAX ? CHUNK_WIDTH_MAX : width;
+  APP_LOG(APP_LOG_LEVEL_INFO, "Chunk width: %d px", s_chunk_width);
+}
 
-      // Request more news if we haven't reached the limit and user is not
-      // navigating
-      if (news_titles_count < news_max_count && !s_user_navigating) {
-        news_timer = app_timer_register(100, news_timer_callback, NULL);
+// Message received callback
+static void inbox_received_callback(DictionaryIterator *iterator,
+                                    void *context) {
+  trace_inbox(iterator);
+  APP_LOG(APP_LOG_LEVEL_INFO, "Received message from JS");
+  s_perf.msgs_in++;
+
+  // Handle the feed list, or only its hash when JS checks the cached list
+  Tuple *feed_hash_tuple = dict_find(iterator, KEY_FEED_LIST_HASH);
+  if (feed_hash_tuple) {
+    uint32_t hash = feed_hash_tuple->value->uint32;
+    Tuple *feed_list_tuple = dict_find(iterator, KEY_FEED_LIST);
+    if (s_feed_selection_lost && selected_feed_index >= 0 && !s_showing_menu) {
+      send_feed_selection();
+    }
+    if (feed_list_tuple && feed_list_tuple->type == TUPLE_BYTE_ARRAY) {
+      store_feed_list(hash, feed_list_tuple->value->data,
+                      feed_list_tuple->length);
+      // Reload menu if visible
+      if (s_showing_menu && s_menu_layer) {
+        menu_layer_reload_data(s_menu_layer);
       }
+    } else if (hash != s_feed_list_hash) {
+      APP_LOG(APP_LOG_LEVEL_INFO, "Feed list changed (%08lx, cached %08lx)",
+              hash, s_feed_list_hash);
+      request_feed_list();
+    } else {
+      APP_LOG(APP_LOG_LEVEL_INFO, "Cached feed list is current");
     }
-  } else {
-    APP_LOG(APP_LOG_LEVEL_WARNING, "No title found in message");
+    return;
+  }
+
+  // Handle an article chunk
+  Tuple *article_tuple = dict_find(iterator, KEY_NEWS_ARTICLE);
+  if (article_tuple && article_tuple->type == TUPLE_BYTE_ARRAY) {
+    Tuple *index_tuple = dict_find(iterator, KEY_ARTICLE_INDEX);
+    Tuple *seq_tuple = dict_find(iterator, KEY_ARTICLE_SEQ);
+    Tuple *done_tuple = dict_find(iterator, KEY_ARTICLE_DONE);
+    store_article_chunk(index_tuple ? index_tuple->value->uint8 : -1,
+                        seq_tuple ? seq_tuple->value->uint16 : 0,
+                        done_tuple && done_tuple->value->uint8 != 0,
+                        article_tuple->value->data, article_tuple->length);
+    return; // Don't process other messages
+  }
+
+  // Handle a batch of news titles
+  Tuple *titles_tuple = dict_find(iterator, KEY_NEWS_TITLES);
+  if (titles_tuple && titles_tuple->type == TUPLE_BYTE_ARRAY) {
+    Tuple *seq_tuple = dict_find(iterator, KEY_NEWS_SEQ);
+    store_news_titles(seq_tuple ? seq_tuple->value->uint16 : 0,
+                      titles_tuple->value->data, titles_tuple->length);
+    return;
   }
 
   // Gérer l'ouverture de la page de configuration
@@ -1136,22 +2421,10 @@ static void inbox_received_callback(DictionaryIterator *iterator,
     APP_LOG(APP_LOG_LEVEL_INFO, "Config page opened - showing waiting screen");
 
     // Arrêter tous les timers
-    if (rsvp_timer) {
-      app_timer_cancel(rsvp_timer);
-      rsvp_timer = NULL;
-    }
-    if (rsvp_start_timer) {
-      app_timer_cancel(rsvp_start_timer);
-      rsvp_start_timer = NULL;
-    }
-    if (news_timer) {
-      app_timer_cancel(news_timer);
-      news_timer = NULL;
-    }
-    if (end_timer) {
-      app_timer_cancel(end_timer);
-      end_timer = NULL;
-    }
+    cancel_event(EVENT_RSVP);
+    cancel_event(EVENT_RSVP_START);
+    cancel_event(EVENT_NEWS);
+    cancel_event(EVENT_END);
 
     // Afficher l'écran d'attente
     s_waiting_for_config = true;
@@ -1189,6 +2462,12 @@ static void inbox_received_callback(DictionaryIterator *iterator,
       persist_write_bool(KEY_BACKLIGHT_ENABLED, s_backlight_enabled);
     }
 
+    Tuple *chunk_tuple = dict_find(iterator, KEY_CHUNK_WIDTH);
+    if (chunk_tuple) {
+      set_chunk_width(chunk_tuple->value->uint8);
+      persist_write_int(KEY_CHUNK_WIDTH, s_chunk_width);
+    }
+
     // Réinitialiser l'état de l'application
     reset_app_state();
     return;
@@ -1214,48 +2493,76 @@ static void inbox_received_callback(DictionaryIterator *iterator,
     APP_LOG(APP_LOG_LEVEL_INFO, "Backlight enabled: %d", s_backlight_enabled);
     persist_write_bool(KEY_BACKLIGHT_ENABLED, s_backlight_enabled);
   }
+
+  Tuple *chunk_tuple = dict_find(iterator, KEY_CHUNK_WIDTH);
+  if (chunk_tuple && !config_received_tuple) {
+    set_chunk_width(chunk_tuple->value->uint8);
+    persist_write_int(KEY_CHUNK_WIDTH, s_chunk_width);
+  }
 }
 
 static void inbox_dropped_callback(AppMessageResult reason, void *context) {
+  trace_message_result(TRACE_INBOX_DROPPED, reason);
   APP_LOG(APP_LOG_LEVEL_ERROR, "Message dropped! Reason: %d", (int)reason);
+  s_perf.msgs_dropped++;
+
+  // It may have been a title batch: repeat the ack so JS resends it
+  if (selected_feed_index >= 0 && !s_news_complete) {
+    ack_news_batches();
+  }
 }
 
 static void outbox_failed_callback(DictionaryIterator *iterator,
                                    AppMessageResult reason, void *context) {
+  trace_message_result(TRACE_OUTBOX_FAILED, reason);
   APP_LOG(APP_LOG_LEVEL_ERROR, "Outbox send failed! Reason: %d", (int)reason);
+  s_perf.msgs_failed++;
+
+  // Let the next word tick, or the starved reader's retry, ask for a lost
+  // article chunk again
+  s_article_requested = false;
+
+  // A selection made from the cached menu before JS was ready is resent
+  // when JS announces the feed list
+  if (dict_find(iterator, KEY_SELECT_FEED)) {
+    s_feed_selection_lost = true;
+  }
+  if (dict_find(iterator, KEY_REQUEST_FEEDS)) {
+    s_feed_list_stale = true;
+  }
 }
 
 static void outbox_sent_callback(DictionaryIterator *iterator, void *context) {
-  // Message sent successfully
+  trace_outbox_sent();
+  s_perf.msgs_out++;
+
+  // A feed list request that found the outbox busy goes out now
+  if (s_feed_list_stale) {
+    request_feed_list();
+  }
+  if (s_perf_report_saved) {
+    send_saved_perf_report();
+  }
+  // A starved reader's chunk request that found the outbox busy
+  if (s_article_starved) {
+    request_next_article_chunk();
+  }
 }
 
 // Start displaying news at given index
 static void display_news_at_index(int8_t index) {
-  if (news_titles_count == 0 || index < 0 || index >= news_titles_count) {
+  if (s_title_pool.count == 0 || index < 0 || index >= s_title_pool.count) {
     return;
   }
 
   // Cancel any existing timers
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-    rsvp_timer = NULL;
-  }
-  if (rsvp_start_timer) {
-    app_timer_cancel(rsvp_start_timer);
-    rsvp_start_timer = NULL;
-  }
-  if (news_timer) {
-    app_timer_cancel(news_timer);
-    news_timer = NULL;
-  }
-  if (end_timer) {
-    app_timer_cancel(end_timer);
-    end_timer = NULL;
-  }
-  if (page_number_timer) {
-    app_timer_cancel(page_number_timer);
-    page_number_timer = NULL;
+  cancel_event(EVENT_RSVP);
+  cancel_event(EVENT_RSVP_START);
+  if (!s_refreshing_cache) {
+    cancel_event(EVENT_NEWS);
   }
+  cancel_event(EVENT_END);
+  cancel_event(EVENT_PAGE_NUMBER);
 
   // Clear end screen state
   s_end_screen = false;
@@ -1264,12 +2571,14 @@ static void display_news_at_index(int8_t index) {
 
   // Copy the selected title to news_title
   current_news_index = index;
-  snprintf(news_title, sizeof(news_title), "%s", news_titles[index]);
+  snprintf(news_title, sizeof(news_title), "%s",
+           pool_get(&s_title_pool, index));
   APP_LOG(APP_LOG_LEVEL_INFO, "Displaying news %d: %s", index, news_title);
 
   // Clear article mode when switching titles
   s_reading_article = false;
-  news_article[0] = '\0';
+  s_article_news_index = -1;
+  s_refresh_match_pending = false;
 
   // Start RSVP for this title
   start_rsvp_for_title();
@@ -1277,6 +2586,11 @@ static void display_news_at_index(int8_t index) {
 
 // Button handlers
 static void select_click_handler(ClickRecognizerRef recognizer, void *context) {
+  trace_click(recognizer, false);
+  if (hide_diagnostics()) {
+    return;
+  }
+
 #if DEMO_MODE
   // In demo mode, any button advances to next word
   if (s_demo_mode_active) {
@@ -1293,42 +2607,57 @@ static void select_click_handler(ClickRecognizerRef recognizer, void *context) {
 
   // If at end screen, exit app
   if (s_paused && s_end_screen) {
-    window_stack_pop(true);
+    exit_app();
     return;
   }
 
   // If we have a valid news index, request the article
-  if (current_news_index >= 0 && current_news_index < news_titles_count) {
+  if (current_news_index >= 0 && current_news_index < s_title_pool.count) {
     // Stop any current title reading
-    if (rsvp_timer) {
-      app_timer_cancel(rsvp_timer);
-      rsvp_timer = NULL;
-    }
-    if (rsvp_start_timer) {
-      app_timer_cancel(rsvp_start_timer);
-      rsvp_start_timer = NULL;
-    }
-    if (page_number_timer) {
-      app_timer_cancel(page_number_timer);
-      page_number_timer = NULL;
-    }
+    cancel_event(EVENT_RSVP);
+    cancel_event(EVENT_RSVP_START);
+    cancel_event(EVENT_PAGE_NUMBER);
 
     // Reset page number display state
     s_showing_page_number = false;
 
     // Remember which news we're reading the article for
     s_article_news_index = current_news_index;
-
-    // Request the article from JS
-    request_article_from_js(current_news_index);
+    s_select_time_ms = now_ms();
+
+    if (s_article_stream_index == current_news_index &&
+        s_article_head > 0) {
+      // Prefetched: start reading right away and stream the rest
+      s_prefetch_hits++;
+      start_article_reading();
+      request_next_article_chunk();
+      if (s_reading_article) {
+        return;
+      }
+    } else if (s_article_stream_index == current_news_index) {
+      // The prefetch is still on its way: ask again so JS sends it ahead of
+      // background traffic
+      s_prefetch_misses++;
+      s_article_requested = false;
+      request_next_article_chunk();
+    } else {
+      // Request the first chunk of the article from JS
+      s_prefetch_misses++;
+      prefetch_article(current_news_index);
+    }
 
     // Show waiting state
     rsvp_word[0] = '\0';
-    layer_mark_dirty(s_canvas_layer);
+    mark_word_dirty();
   }
 }
 
 static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
+  trace_click(recognizer, false);
+  if (hide_diagnostics()) {
+    return;
+  }
+
 #if DEMO_MODE
   // In demo mode, any button advances to next word
   if (s_demo_mode_active) {
@@ -1344,21 +2673,17 @@ static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
   }
 
   // Previous news
-  if (news_titles_count == 0) {
+  if (s_title_pool.count == 0) {
     return;
   }
 
   // Stop automatic news fetching when user starts navigating
-  s_user_navigating = true;
-  if (news_timer) {
-    app_timer_cancel(news_timer);
-    news_timer = NULL;
-  }
+  stop_title_fetch();
 
   int8_t new_index;
   if (current_news_index <= 0) {
     // Wrap to end
-    new_index = news_titles_count - 1;
+    new_index = s_title_pool.count - 1;
   } else {
     new_index = current_news_index - 1;
   }
@@ -1367,6 +2692,11 @@ static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
 }
 
 static void down_click_handler(ClickRecognizerRef recognizer, void *context) {
+  trace_click(recognizer, false);
+  if (hide_diagnostics()) {
+    return;
+  }
+
 #if DEMO_MODE
   // In demo mode, any button advances to next word
   if (s_demo_mode_active) {
@@ -1382,19 +2712,15 @@ static void down_click_handler(ClickRecognizerRef recognizer, void *context) {
   }
 
   // Next news
-  if (news_titles_count == 0) {
+  if (s_title_pool.count == 0) {
     return;
   }
 
   // Stop automatic news fetching when user starts navigating
-  s_user_navigating = true;
-  if (news_timer) {
-    app_timer_cancel(news_timer);
-    news_timer = NULL;
-  }
+  stop_title_fetch();
 
   int8_t new_index;
-  if (current_news_index >= news_titles_count - 1) {
+  if (current_news_index >= s_title_pool.count - 1) {
     // Wrap to beginning
     new_index = 0;
   } else {
@@ -1405,20 +2731,19 @@ static void down_click_handler(ClickRecognizerRef recognizer, void *context) {
 }
 
 static void back_click_handler(ClickRecognizerRef recognizer, void *context) {
+  trace_click(recognizer, false);
+  if (hide_diagnostics()) {
+    return;
+  }
+
   // If reading article, stop and go back to title list
   if (s_reading_article) {
     // Cancel timers
-    if (rsvp_timer) {
-      app_timer_cancel(rsvp_timer);
-      rsvp_timer = NULL;
-    }
-    if (rsvp_start_timer) {
-      app_timer_cancel(rsvp_start_timer);
-      rsvp_start_timer = NULL;
-    }
+    cancel_event(EVENT_RSVP);
+    cancel_event(EVENT_RSVP_START);
 
     s_reading_article = false;
-    news_article[0] = '\0';
+    reset_article_stream();
     s_article_news_index = -1;
 
     // Go back to showing the title
@@ -1428,37 +2753,26 @@ static void back_click_handler(ClickRecognizerRef recognizer, void *context) {
 
   // If showing menu, exit the app
   if (s_showing_menu) {
-    window_stack_pop(true);
+    exit_app();
     return;
   }
 
   // Otherwise, go back to journal menu
   // Cancel all timers
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-    rsvp_timer = NULL;
-  }
-  if (rsvp_start_timer) {
-    app_timer_cancel(rsvp_start_timer);
-    rsvp_start_timer = NULL;
-  }
-  if (news_timer) {
-    app_timer_cancel(news_timer);
-    news_timer = NULL;
-  }
-  if (end_timer) {
-    app_timer_cancel(end_timer);
-    end_timer = NULL;
-  }
-  if (page_number_timer) {
-    app_timer_cancel(page_number_timer);
-    page_number_timer = NULL;
-  }
+  cancel_all_events();
 
   // Reset news state
-  news_titles_count = 0;
+  s_article_news_index = -1;
+  reset_article_stream();
+  pool_reset(&s_title_pool);
   current_news_index = -1;
   news_title[0] = '\0';
+  s_news_complete = false;
+  s_news_expected_seq = 0;
+  s_news_ack_pending = false;
+  s_titles_from_cache = false;
+  s_refreshing_cache = false;
+  s_refresh_match_pending = false;
   rsvp_word[0] = '\0';
   s_end_screen = false;
   s_paused = false;
@@ -1466,15 +2780,30 @@ static void back_click_handler(ClickRecognizerRef recognizer, void *context) {
   s_showing_page_number = false;
   s_user_navigating = false;
 
+  send_perf_report();
+
   // Show the journal menu
   show_journal_menu();
 }
 
+// Long press Select: show or hide the diagnostics screen
+static void select_long_click_handler(ClickRecognizerRef recognizer,
+                                      void *context) {
+  trace_click(recognizer, true);
+  if (hide_diagnostics()) {
+    return;
+  }
+  s_showing_diagnostics = true;
+  layer_mark_dirty(s_canvas_layer);
+}
+
 static void click_config_provider(void *context) {
   window_single_click_subscribe(BUTTON_ID_SELECT, select_click_handler);
   window_single_click_subscribe(BUTTON_ID_UP, up_click_handler);
   window_single_click_subscribe(BUTTON_ID_DOWN, down_click_handler);
   window_single_click_subscribe(BUTTON_ID_BACK, back_click_handler);
+  window_long_click_subscribe(BUTTON_ID_SELECT, 700, select_long_click_handler,
+                              NULL);
 }
 
 // Window load/unload
@@ -1488,6 +2817,12 @@ static void main_window_load(Window *window) {
   layer_add_child(window_layer, s_canvas_layer);
   layer_set_hidden(s_canvas_layer, true); // Start hidden
 
+  // Word band on top of the chrome, the only part redrawn on each word
+  s_word_layer = layer_create(GRect(0, SPRITZ_WORD_BAND_TOP, bounds.size.w,
+                                    SPRITZ_WORD_BAND_HEIGHT));
+  layer_set_update_proc(s_word_layer, word_update_proc);
+  layer_add_child(s_canvas_layer, s_word_layer);
+
   // Create menu layer for journal selection
   s_menu_layer = menu_layer_create(bounds);
   menu_layer_set_callbacks(s_menu_layer, NULL,
@@ -1503,18 +2838,44 @@ static void main_window_load(Window *window) {
   window_set_click_config_provider(s_main_window, menu_click_config_provider);
 }
 
+// The frame buffer may have been overwritten while the window was hidden
+static void main_window_appear(Window *window) { invalidate_chrome(); }
+
+static void app_did_focus(bool in_focus) {
+  if (in_focus) {
+    invalidate_chrome();
+  }
+}
+
 static void main_window_unload(Window *window) {
+  layer_destroy(s_word_layer);
   layer_destroy(s_canvas_layer);
   menu_layer_destroy(s_menu_layer);
 }
 
 // Init
 static void init(void) {
+  trace_start();
   s_main_window = window_create();
 
-  window_set_window_handlers(
-      s_main_window,
-      (WindowHandlers){.load = main_window_load, .unload = main_window_unload});
+  // Clear background: the window does not fill the frame buffer, so the
+  // chrome stays in it between frames (see draw_canvas)
+  window_set_background_color(s_main_window, GColorClear);
+  window_set_window_handlers(s_main_window,
+                             (WindowHandlers){.load = main_window_load,
+                                              .appear = main_window_appear,
+                                              .unload = main_window_unload});
+  app_focus_service_subscribe_handlers(
+      (AppFocusHandlers){.did_focus = app_did_focus});
+
+  // Show the cached feed list at once; JS only resends it if its hash differs
+  s_feed_list_hash = pool_cached_tag(PERSIST_KEY_FEED_CACHE);
+  if (pool_restore(&s_feed_pool, PERSIST_KEY_FEED_CACHE, s_feed_list_hash)) {
+    feed_count = s_feed_pool.count;
+    pool_log(&s_feed_pool, "Cached feed");
+  } else {
+    s_feed_list_hash = 0;
+  }
 
   window_stack_push(s_main_window, true);
 
@@ -1537,20 +2898,33 @@ static void init(void) {
     APP_LOG(APP_LOG_LEVEL_INFO, "Using default backlight enabled: true");
   }
 
+  // Load the saved chunk width; single words by default
+  if (persist_exists(KEY_CHUNK_WIDTH)) {
+    set_chunk_width(persist_read_int(KEY_CHUNK_WIDTH));
+  }
+
+  // A report the last session could not send goes out once a message has
+  // reached JS
+  s_perf_report_saved = persist_exists(PERSIST_KEY_PERF_REPORT);
+
   // Register AppMessage handlers
   app_message_register_inbox_received(inbox_received_callback);
   app_message_register_inbox_dropped(inbox_dropped_callback);
   app_message_register_outbox_failed(outbox_failed_callback);
   app_message_register_outbox_sent(outbox_sent_callback);
 
-  // Open AppMessage with larger buffers
-  const uint32_t inbox_size = 512;
-  const uint32_t outbox_size = 128;
-  app_message_open(inbox_size, outbox_size);
-  APP_LOG(APP_LOG_LEVEL_INFO, "AppMessage opened with inbox=%lu, outbox=%lu",
-          inbox_size, outbox_size);
+  // Open AppMessage with the largest inbox the platform and budget allow;
+  // JS sizes title batches and article chunks from it
+  s_inbox_size = app_message_inbox_size_maximum();
+  if (s_inbox_size > INBOX_SIZE_BUDGET) {
+    s_inbox_size = INBOX_SIZE_BUDGET;
+  }
+  s_article_chunk_max = s_inbox_size - ARTICLE_MESSAGE_OVERHEAD;
+  app_message_open(s_inbox_size, OUTBOX_SIZE);
+  APP_LOG(APP_LOG_LEVEL_INFO, "AppMessage opened with inbox=%lu, outbox=%d",
+          s_inbox_size, OUTBOX_SIZE);
 
-  // App starts with journal menu - feed names will be sent by JS on ready
+  // App starts with journal menu - JS checks the feed list hash on ready
 
 #if DEMO_MODE
   // In demo mode, skip the menu and start demo directly
@@ -1561,28 +2935,20 @@ static void init(void) {
 
 // Deinit
 static void deinit(void) {
-  if (news_timer) {
-    app_timer_cancel(news_timer);
-    news_timer = NULL;
-  }
-  if (rsvp_timer) {
-    app_timer_cancel(rsvp_timer);
-    rsvp_timer = NULL;
-  }
-  if (rsvp_start_timer) {
-    app_timer_cancel(rsvp_start_timer);
-    rsvp_start_timer = NULL;
-  }
-  if (end_timer) {
-    app_timer_cancel(end_timer);
-    end_timer = NULL;
-  }
-  if (page_number_timer) {
-    app_timer_cancel(page_number_timer);
-    page_number_timer = NULL;
+  trace_end();
+  cancel_all_events();
+
+  // Closed from the system (Back held, another app) or with the outbox busy:
+  // keep the report for the next session to send
+  if (!s_perf_reported) {
+    char report[PERF_REPORT_LEN];
+    format_perf_report(report, sizeof(report));
+    APP_LOG(APP_LOG_LEVEL_INFO, "Perf: %s", report);
+    persist_write_string(PERSIST_KEY_PERF_REPORT, report);
   }
 
   app_message_deregister_callbacks();
+  app_focus_service_unsubscribe();
   window_destroy(s_main_window);
 }
 
@@ -0,0 +1,444 @@
+#include "rsvp_text.h"
+
+#include <string.h>
+
+#include "rsvp_words.h"
+
+// Build the word index for a text in a single pass
+void index_words(WordIndex *index, const char *text) {
+  index->text = text ? text : "";
+  index->count = 0;
+
+  const char *p = index->text;
+  uint16_t i = 0;
+  while (p[i] != '\0' && index->count < MAX_WORDS) {
+    // Skip separators
+    while (p[i] == ' ' || p[i] == '\t' || p[i] == '\n') {
+      i++;
+    }
+    if (p[i] == '\0') {
+      break;
+    }
+
+    // Record the word span
+    uint16_t start = i;
+    while (p[i] != '\0' && p[i] != ' ' && p[i] != '\t' && p[i] != '\n') {
+      i++;
+    }
+    uint16_t len = i - start;
+    index->offsets[index->count] = start;
+    index->lengths[index->count] = (len > 255) ? 255 : len;
+    index->count++;
+  }
+}
+
+// Copy an indexed word out of the text
+bool copy_indexed_word(const WordIndex *index, uint16_t i, char *buffer,
+                       size_t size) {
+  if (i >= index->count) {
+    buffer[0] = '\0';
+    return false;
+  }
+
+  size_t word_len = index->lengths[i];
+  if (word_len > size - 1) {
+    word_len = size - 1;
+  }
+  memcpy(buffer, &index->text[index->offsets[i]], word_len);
+  buffer[word_len] = '\0';
+  return true;
+}
+
+// Calculate the optimal recognition point (ORP) / pivot letter index
+// Based on Spritz algorithm from OpenSpritz
+int get_pivot_index(int word_length) {
+  if (word_length <= 0)
+    return 0;
+
+  switch (word_length) {
+  case 1:
+    return 0; // first letter (index 0)
+  case 2:
+  case 3:
+  case 4:
+  case 5:
+    return 1; // second letter (index 1)
+  case 6:
+  case 7:
+  case 8:
+  case 9:
+    return 2; // third letter (index 2)
+  case 10:
+  case 11:
+  case 12:
+  case 13:
+    return 3; // fourth letter (index 3)
+  default:
+    return 4; // fifth letter (index 4)
+  }
+}
+
+// Pivot of a word or chunk, always on the first byte of a letter
+int get_text_pivot_index(const char *text, int length) {
+  if (length <= 0) {
+    return 0;
+  }
+  int pivot = get_pivot_index(length);
+  if (pivot >= length) {
+    pivot = length - 1;
+  }
+  while (pivot < length - 1 && text[pivot] == ' ') {
+    pivot++;
+  }
+  while (pivot > 0 && ((uint8_t)text[pivot] & 0xC0) == 0x80) {
+    pivot--;
+  }
+  return pivot;
+}
+
+// Word weights: WORD_WEIGHT_AVERAGE for a word of average difficulty
+#define WORD_WEIGHT_MAX 32
+#define WORD_WEIGHT_LONG_FROM 7 // Unlisted words from this many letters on...
+#define WORD_WEIGHT_PER_LETTER 2 // ...weigh this much more per letter
+#define WORD_WEIGHT_CAPITAL 4   // Unlisted capitalized word: likely a name
+static const uint8_t s_class_weights[] = {9, 12, 14}; // By frequency class
+
+// The mean weight starts from this many half slots of average text, so the
+// first words of a text are not scaled by a mean of one or two
+#define PACING_PRIOR_PAUSES 64
+#define PACING_PRIOR_WEIGHT 14 // Mean weight of news text
+
+#define WORD_KEY_MAX 31 // Longer words are not in the table, see word_weight()
+
+// Whether a byte is part of a letter or digit: ASCII alphanumerics and UTF-8
+// letters, but not the punctuation blocks (U+0080-U+00BF, U+2000-U+206F)
+static bool is_word_byte(const uint8_t *p, const uint8_t *end) {
+  uint8_t c = *p;
+  if (c < 0x80) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+           (c >= 'A' && c <= 'Z');
+  }
+  if (c == 0xC2) {
+    return false;
+  }
+  if (c == 0xE2 && p + 1 < end && (p[1] == 0x80 || p[1] == 0x81)) {
+    return false;
+  }
+  return true;
+}
+
+// Normalize a word for the table into key: strip the punctuation around it,
+// lowercase ASCII and Latin-1 capitals, straighten curly apostrophes. Returns
+// the key length, 0 if the word has no letters or is too long.
+static size_t normalize_word(const char *word, char *key) {
+  const uint8_t *start = (const uint8_t *)word;
+  const uint8_t *end = start + strlen(word);
+  while (start < end && !is_word_byte(start, end)) {
+    start++;
+  }
+  while (end > start) {
+    // Step back over one character, UTF-8 continuation bytes included
+    const uint8_t *last = end - 1;
+    while (last > start && (*last & 0xC0) == 0x80) {
+      last--;
+    }
+    if (is_word_byte(last, end)) {
+      break;
+    }
+    end = last;
+  }
+
+  size_t length = 0;
+  for (const uint8_t *p = start; p < end; p++) {
+    if (length >= WORD_KEY_MAX) {
+      return 0;
+    }
+    uint8_t c = *p;
+    if (c >= 'A' && c <= 'Z') {
+      c += 'a' - 'A';
+    } else if (c == 0xE2 && p + 2 < end && p[1] == 0x80 && p[2] == 0x99) {
+      c = '\''; // U+2019 right single quotation mark
+      p += 2;
+    } else if (c == 0xC3 && p + 1 < end && p[1] >= 0x80 && p[1] <= 0x9E &&
+               p[1] != 0x97) {
+      key[length++] = c;
+      c = *++p + 0x20; // Latin-1 capital to small letter
+    }
+    key[length++] = c;
+  }
+  return length;
+}
+
+// 32-bit FNV-1a folded to 16 bits, as in tools/pacing/gen_word_table.js
+static uint16_t hash_word(const char *key, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)key[i]) * 16777619u;
+  }
+  return (hash >> 16) ^ (hash & 0xFFFF);
+}
+
+// Frequency class of a normalized word, or -1 if it is not in the table
+static int lookup_word_class(const char *key, size_t length) {
+  uint16_t hash = hash_word(key, length);
+  int low = 0;
+  int high = WORD_TABLE_SIZE - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    if (WORD_TABLE_HASHES[mid] < hash) {
+      low = mid + 1;
+    } else if (WORD_TABLE_HASHES[mid] > hash) {
+      high = mid - 1;
+    } else {
+      return (WORD_TABLE_CLASSES[mid / 4] >> ((mid % 4) * 2)) & 3;
+    }
+  }
+  return -1;
+}
+
+// Weight of a word: its frequency class if listed (or, for an elided form
+// like "l'économie", the part after the apostrophe), else its length
+uint8_t word_weight(const char *word) {
+  char key[WORD_KEY_MAX + 1]; // A Latin-1 capital can end on the last byte
+  size_t length = normalize_word(word, key);
+  if (length == 0) {
+    return WORD_WEIGHT_AVERAGE;
+  }
+
+  int word_class = lookup_word_class(key, length);
+  size_t start = 0;
+  if (word_class < 0) {
+    const char *apostrophe = memchr(key, '\'', length);
+    if (apostrophe && apostrophe < key + length - 1) {
+      start = apostrophe + 1 - key;
+      word_class = lookup_word_class(key + start, length - start);
+    }
+  }
+  if (word_class >= 0) {
+    return s_class_weights[word_class];
+  }
+
+  int letters = 0;
+  for (size_t i = start; i < length; i++) {
+    if (((uint8_t)key[i] & 0xC0) != 0x80) {
+      letters++;
+    }
+  }
+  int weight = WORD_WEIGHT_AVERAGE;
+  if (letters >= WORD_WEIGHT_LONG_FROM) {
+    weight += (letters - WORD_WEIGHT_LONG_FROM + 1) * WORD_WEIGHT_PER_LETTER;
+  }
+  uint8_t first = (uint8_t)word[0];
+  if ((first >= 'A' && first <= 'Z') ||
+      (first == 0xC3 && (uint8_t)word[1] >= 0x80 && (uint8_t)word[1] <= 0x9E)) {
+    weight += WORD_WEIGHT_CAPITAL;
+  }
+  return weight > WORD_WEIGHT_MAX ? WORD_WEIGHT_MAX : weight;
+}
+
+// Time a word is shown for relative to a slot, in half slots: tripled for
+// sentence-ending punctuation (. ! ?), doubled for clause-ending punctuation
+// (, : ; )), 1.5 times for an opening parenthesis or dash inside the word
+static uint8_t word_pause(const char *word) {
+  char last_char = word[strlen(word) - 1];
+  if (last_char == '.' || last_char == '!' || last_char == '?') {
+    return 6;
+  }
+  if (last_char == ',' || last_char == ':' || last_char == ';' ||
+      last_char == ')') {
+    return 4;
+  }
+  if (strchr(word, '(') || strchr(word, '-')) {
+    return 3;
+  }
+  return 2;
+}
+
+void pacing_reset(PacingState *state) {
+  state->weight_sum = 0;
+  state->pause_sum = 0;
+  state->drift_ms = 0;
+}
+
+// The mean is weighted by pauses: words before a pause are more often rare
+// ones, and a plain mean would let them stretch the text
+void pacing_add_word(PacingState *state, const char *word, uint16_t base_ms) {
+  if (!word || word[0] == '\0' || state->pause_sum > UINT16_MAX) {
+    return;
+  }
+  uint8_t pause = word_pause(word);
+  state->drift_ms += calculate_word_delay(state, word, base_ms) -
+                     (int32_t)base_ms * pause / 2;
+  state->weight_sum += word_weight(word) * pause;
+  state->pause_sum += pause;
+}
+
+// Delay of a word: base_ms scaled by its weight over the text's mean weight
+// and by its pause, less an eighth of the drift (at most a quarter of it)
+uint16_t calculate_word_delay(const PacingState *state, const char *word,
+                              uint16_t base_ms) {
+  if (!word || word[0] == '\0') {
+    return base_ms;
+  }
+
+  // Mean weight in 1/256 units
+  uint32_t mean =
+      ((state->weight_sum + PACING_PRIOR_PAUSES * PACING_PRIOR_WEIGHT) << 8) /
+      (state->pause_sum + PACING_PRIOR_PAUSES);
+  int32_t delay = ((uint32_t)base_ms * word_weight(word) << 8) / mean;
+  delay = delay * word_pause(word) / 2;
+
+  int32_t correction = state->drift_ms / 8;
+  if (correction > delay / 4) {
+    correction = delay / 4;
+  } else if (correction < -delay / 4) {
+    correction = -delay / 4;
+  }
+  delay -= correction;
+  return delay > UINT16_MAX ? UINT16_MAX : delay;
+}
+
+// A short word without pause punctuation can share a flash with the next
+bool word_leads_chunk(const char *word, size_t length) {
+  if (length == 0 || length > CHUNK_LEAD_MAX_LEN) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    char c = word[i];
+    if (c == '.' || c == '!' || c == '?' || c == ',' || c == ':' ||
+        c == ';' || c == ')' || c == '(' || c == '-') {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Delay of a chunk: it is taken in at one fixation, so the short words
+// before the last one only add a quarter slot each for their letters
+uint16_t calculate_chunk_delay(const PacingState *state, const char *last_word,
+                               uint8_t words, uint16_t base_ms) {
+  uint16_t delay = calculate_word_delay(state, last_word, base_ms);
+  if (words > 1) {
+    delay += (words - 1) * (base_ms / 4);
+  }
+  return delay;
+}
+
+#define TEXT_SHORT_CODES 40 // Entries with a one-byte code
+
+// Dictionary of packed text, tuned for English and French news: entry n ends
+// at its NUL and the table at an empty entry.
+// Must match TEXT_DICT in pebble-js-app.js
+static const char s_text_dict[] =
+    // One-byte codes
+    " the\0" " de \0" "tion\0" " and\0" " to \0" " of \0" " la \0" " le \0"
+    " in \0" "ing \0" "ing\0" " a \0" "es \0" "ed \0" "er \0" "e \0" "s \0"
+    "t \0" "d \0" ", \0" ". \0" " et \0" " les\0" " des\0" " du \0" " en \0"
+    " un\0" " is \0" "ent\0" "re\0" "er\0" "on\0" "an\0" "th\0" "in\0" "ou\0"
+    "qu\0" "es\0" "or\0" "\xc3\xa9\0"
+    // Two-byte codes: TEXT_PACK_ESCAPE and the entry number
+    " that\0" " for \0" " with\0" " was \0" " on \0" " are \0" " as \0"
+    " his \0" " they\0" " be \0" " at \0" " one\0" " have\0" " this\0" " from\0"
+    " by \0" " had \0" " not \0" " but \0" " what\0" " all \0" " were\0"
+    " when\0" " we \0" " there\0" " can\0" " said\0" " which\0" " their\0"
+    " will\0" " would\0" " about\0" " more\0" " new \0" " has \0" " after\0"
+    " been\0" " over\0" " year\0" " people\0" " first\0" " also\0" " could\0"
+    " into\0" " other\0" " than\0" " its \0" " who \0" " against\0" " between\0"
+    " percent\0" " million\0" " billion\0" " police\0" " state\0" " world\0"
+    " week\0" " told\0" " says\0" " report\0" " company\0" " during\0"
+    " before\0" " while\0" " three\0" " two \0" " some\0" " out \0" " up \0"
+    " it \0" " an \0" " or \0" " he \0" " she \0" " her \0" " you\0" " just\0"
+    " only\0" " most\0" " time\0" " may \0" " under\0" " where\0" " because\0"
+    " last\0" " officia\0" " governm\0" " preside\0" " pour\0" " que \0"
+    " qui \0" " dans\0" " sur \0" " par \0" " pas \0" " est \0" " plus\0"
+    " avec\0" " une \0" " au \0" " aux \0" " il \0" " elle\0" " ont \0"
+    " \xc3\xa9t\xc3\xa9\0" " ses \0" " son \0" " sa \0" " ce \0" " cette\0"
+    " mais\0" " comme\0" " aussi\0" " selon\0" " apr\xc3\xa8s\0" " entre\0"
+    " leur\0" " sont\0" " fait\0" " \xc3\xaatre\0" " avait\0" " contre\0"
+    " depuis\0" " deux\0" " trois\0" " ans \0" " ann\xc3\xa9" "e\0" " tout\0"
+    " tous\0" " m\xc3\xaame\0" " encore\0" " ne \0" " se \0" " lors\0" " dont\0"
+    " sans\0" " nous\0" " ils \0" " \xc3\xa0 \0" " l'\0" " d'\0"
+    " l\xe2\x80\x99\0" " d\xe2\x80\x99\0" "\xe2\x80\x99s \0" "'s \0"
+    "\xe2\x80\x99\0" "\xc2\xab \0" " \xc2\xbb\0" "\xe2\x80\x9c\0"
+    "\xe2\x80\x9d\0" " \xe2\x80\x94 \0" "ment \0" "ment\0" "tions\0" "ation\0"
+    "ement\0" "ique\0" "ness\0" "ally\0" "ould\0" "ight\0" "ers \0" "ies \0"
+    "eur\0" "ait \0" "ant \0" "ons \0" "ions\0" "ted \0" "ter\0" "ate\0" "ion\0"
+    "ere\0" "ver\0" "all\0" "con\0" "pro\0" "com\0" "ure\0" "ous\0" "ell\0"
+    "ess\0" "est\0" "ist\0" "res\0" "men\0" "ien\0" "ait\0" " The \0" " Le \0"
+    " La \0" " Les \0" " Il \0" " In \0" " A \0" " Un\0" "The \0" "Le \0"
+    "La \0" "Les \0";
+
+// Entry number of a one-byte code, or -1 for a literal byte
+static int text_code_entry(uint8_t code) {
+  if (code >= 0x01 && code <= 0x08) {
+    return code - 0x01;
+  }
+  if (code == 0x0B || code == 0x0C) {
+    return code - 0x0B + 8;
+  }
+  if (code >= 0x0E && code <= 0x1F) {
+    return code - 0x0E + 10;
+  }
+  if (code == 0xC0 || code == 0xC1) {
+    return code - 0xC0 + 28;
+  }
+  if (code >= 0xF5 && code <= 0xFE) {
+    return code - 0xF5 + 30;
+  }
+  return -1;
+}
+
+// Offset of every 16th dictionary entry, so a lookup skips at most 15
+#define TEXT_DICT_MARK_SHIFT 4
+#define TEXT_DICT_MARKS ((TEXT_SHORT_CODES + 256) >> TEXT_DICT_MARK_SHIFT)
+static uint16_t s_text_dict_marks[TEXT_DICT_MARKS + 1];
+static bool s_text_dict_marked = false;
+
+// Dictionary entry n, or NULL past the end of the table
+static const char *text_dict_entry(int n) {
+  if (!s_text_dict_marked) {
+    const char *entry = s_text_dict;
+    for (int i = 0; i <= TEXT_DICT_MARKS << TEXT_DICT_MARK_SHIFT; i++) {
+      if ((i & ((1 << TEXT_DICT_MARK_SHIFT) - 1)) == 0) {
+        s_text_dict_marks[i >> TEXT_DICT_MARK_SHIFT] = entry - s_text_dict;
+      }
+      if (*entry != '\0') {
+        entry += strlen(entry) + 1;
+      }
+    }
+    s_text_dict_marked = true;
+  }
+
+  const char *entry = s_text_dict + s_text_dict_marks[n >> TEXT_DICT_MARK_SHIFT];
+  for (n &= (1 << TEXT_DICT_MARK_SHIFT) - 1; n > 0 && *entry != '\0'; n--) {
+    entry += strlen(entry) + 1;
+  }
+  return (*entry != '\0') ? entry : NULL;
+}
+
+// Expand codes on the fly, writing each byte straight to its ring slot
+uint16_t unpack_text(const uint8_t *packed, uint16_t length, char *ring,
+                     uint16_t head, uint16_t mask, uint16_t max) {
+  uint16_t written = 0;
+  uint16_t pos = 0;
+  while (pos < length && written < max) {
+    uint8_t code = packed[pos++];
+    int n = text_code_entry(code);
+    if (code == TEXT_PACK_ESCAPE) {
+      if (pos == length) {
+        break; // Escape cut off at the end
+      }
+      n = TEXT_SHORT_CODES + packed[pos++];
+    }
+
+    if (n < 0) {
+      ring[(head + written++) & mask] = (char)code;
+      continue;
+    }
+    const char *entry = text_dict_entry(n);
+    while (entry && *entry != '\0' && written < max) {
+      ring[(head + written++) & mask] = *entry++;
+    }
+  }
+  return written;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Text logic of the RSVP reader: word splitting, pivot letter, pacing and
+// unpacking of the compressed text sent by the phone.
+// It only uses the C library, so it can be compiled and timed on a host.
+
+#define MAX_WORDS 80 // A 160-byte title holds at most 80 words
+
+// Word index: (offset, length) of every word in a text, built in one pass so
+// word N can be fetched directly
+typedef struct {
+  const char *text;
+  uint16_t offsets[MAX_WORDS];
+  uint8_t lengths[MAX_WORDS];
+  uint16_t count;
+} WordIndex;
+
+// Index the space-separated words of text (kept by reference)
+void index_words(WordIndex *index, const char *text);
+
+// Copy word i into buffer, truncated to fit; false if there is no word i
+bool copy_indexed_word(const WordIndex *index, uint16_t i, char *buffer,
+                       size_t size);
+
+// Spritz pivot letter (Optimal Recognition Point) for a word length
+int get_pivot_index(int word_length);
+
+// Pivot byte of a word or chunk of words: the Spritz pivot for its length,
+// moved off a space onto the next letter and onto the start of a UTF-8
+// character
+int get_text_pivot_index(const char *text, int length);
+
+// Word pacing: every word has a weight for how long it takes to read, from
+// the frequency table in rsvp_words.h for common words and from length and
+// capitals for the others. A word is shown for base_ms scaled by its weight
+// over the mean weight of the text so far, so frequent words go faster, rare
+// and long ones slower. Punctuation pauses come on top, as in Spritz. Time
+// given beyond base_ms per word (plus pauses) is taken back from the next
+// words, so the text as a whole reads at the target speed.
+#define WORD_WEIGHT_AVERAGE 16 // Weight shown for exactly base_ms
+typedef struct {
+  uint32_t weight_sum; // Weights of the words paced so far, times their pause
+  uint32_t pause_sum;  // Their pauses, in half slots
+  int32_t drift_ms;    // Time they were given beyond the target speed
+} PacingState;
+
+// Start pacing a new text
+void pacing_reset(PacingState *state);
+
+// Reading weight of a word
+uint8_t word_weight(const char *word);
+
+// Count a word shown for calculate_word_delay() in the text's mean weight and
+// drift
+void pacing_add_word(PacingState *state, const char *word, uint16_t base_ms);
+
+// Display time of a word at base_ms per average word
+uint16_t calculate_word_delay(const PacingState *state, const char *word,
+                              uint16_t base_ms);
+
+// Chunking: short words are shown together with the word after them in one
+// flash. A word leads a chunk when it has at most CHUNK_LEAD_MAX_LEN bytes and
+// no punctuation that calls for a pause.
+#define CHUNK_LEAD_MAX_LEN 4
+bool word_leads_chunk(const char *word, size_t length);
+
+// Display time of a flash of words ending with last_word: the last word's
+// delay plus a quarter slot per word before it
+uint16_t calculate_chunk_delay(const PacingState *state, const char *last_word,
+                               uint8_t words, uint16_t base_ms);
+
+// Packed text: UTF-8 where bytes that never occur in news text stand for
+// dictionary entries. The control codes 0x01-0x1F (except tab, newline and
+// carriage return), 0xC0, 0xC1 and 0xF5-0xFE each stand for one of the 40
+// most frequent entries; TEXT_PACK_ESCAPE followed by a byte n stands for
+// entry 40 + n. Every other byte is itself.
+#define TEXT_PACK_ESCAPE 0xFF
+
+// Unpack text into ring[(head + i) & mask] for i < max and return the bytes
+// written. Pass head 0 and mask 0xFFFF to unpack into a flat buffer.
+uint16_t unpack_text(const uint8_t *packed, uint16_t length, char *ring,
+                     uint16_t head, uint16_t mask, uint16_t max);
@@ -0,0 +1,32 @@
+#pragma once
+
+// Session traces: with TRACE_RECORD set, rsvp_news.c records what drives it
+// (the persisted state it starts from, button clicks, inbound messages,
+// outbox results) and the timed events it runs, so tools/replay can replay a
+// session on the host.
+//
+// A trace is a stream of records:
+//   kind      1 byte, a TraceKind
+//   delay     varint, ms since the previous record
+//   length    varint, bytes of payload
+//   payload
+// Varints are little-endian base 128, 7 bits per byte, high bit set on all
+// but the last byte. Multi-byte payload fields are little-endian.
+//
+// The watch writes the stream to the app log 32 bytes at a time, as lines
+// "TRACE <line number> <hex bytes>", numbered from 0 so gaps show.
+
+#define TRACE_VERSION 1
+#define TRACE_LINE_BYTES 32
+
+typedef enum {
+  TRACE_START = 1,       // Version (1), inbox size maximum (4)
+  TRACE_PERSIST = 2,     // Key (4), stored bytes
+  TRACE_CLICK = 3,       // ButtonId (1), 1 for a long click (1)
+  TRACE_INBOX = 4,       // Tuples: key (4), TupleType (1), length (2), data
+  TRACE_INBOX_DROPPED = 5, // AppMessageResult (2)
+  TRACE_OUTBOX_SENT = 6,   // Nothing
+  TRACE_OUTBOX_FAILED = 7, // AppMessageResult (2)
+  TRACE_EVENT = 8,       // EventType (1) of a timed event run
+  TRACE_END = 9,         // Nothing: the app is exiting
+} TraceKind;
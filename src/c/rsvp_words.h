@@ -0,0 +1,81 @@
+// Generated by tools/pacing/gen_word_table.js from en.txt, fr.txt. Do not edit.
+// en.txt: 249 words, fr.txt: 199 words; 441 hashes.
+#pragma once
+
+#include <stdint.h>
+
+#define WORD_TABLE_SIZE 441
+
+// Sorted 16-bit hashes of the listed words
+static const uint16_t WORD_TABLE_HASHES[WORD_TABLE_SIZE] = {
+    0x004B, 0x007B, 0x0097, 0x02D8, 0x03C1, 0x040B, 0x0423, 0x04AD,
+    0x05C2, 0x0612, 0x08AA, 0x09AE, 0x0A2F, 0x0A38, 0x0A61, 0x0A67,
+    0x0AAA, 0x0B0C, 0x0BF6, 0x0C54, 0x0C97, 0x0CAD, 0x0CDD, 0x0DCC,
+    0x0F0B, 0x0F59, 0x1018, 0x1046, 0x10CC, 0x1134, 0x1141, 0x1166,
+    0x117A, 0x11D2, 0x138F, 0x13AC, 0x1438, 0x1469, 0x15B8, 0x179A,
+    0x18D3, 0x1A33, 0x1BF7, 0x1C2C, 0x1CAB, 0x1DBF, 0x1F24, 0x1F60,
+    0x211D, 0x2130, 0x2211, 0x2316, 0x236C, 0x237C, 0x23D6, 0x241B,
+    0x2490, 0x2508, 0x2527, 0x26FD, 0x29E6, 0x2AD9, 0x2AFF, 0x2CD9,
+    0x2CE6, 0x2D50, 0x2F63, 0x30DD, 0x31A0, 0x32A1, 0x32F4, 0x337A,
+    0x33DA, 0x3453, 0x34B3, 0x356B, 0x3588, 0x35F5, 0x360D, 0x365D,
+    0x36F7, 0x3724, 0x380A, 0x3979, 0x3A02, 0x3A0C, 0x3A6B, 0x3AA1,
+    0x3B33, 0x3BA6, 0x3C0B, 0x3C89, 0x3D2D, 0x3D6C, 0x4103, 0x4123,
+    0x4135, 0x415A, 0x425C, 0x4289, 0x42AD, 0x42DE, 0x4390, 0x439B,
+    0x4434, 0x447B, 0x44D3, 0x44F0, 0x4588, 0x46A1, 0x4772, 0x483E,
+    0x4840, 0x4863, 0x490C, 0x4933, 0x499A, 0x49A0, 0x4A6C, 0x4AAC,
+    0x4AC7, 0x4B7B, 0x4C2C, 0x4CBD, 0x4D19, 0x4DA6, 0x4DD3, 0x4EDB,
+    0x4EE4, 0x4F3E, 0x5001, 0x50A3, 0x51FB, 0x543A, 0x5506, 0x555C,
+    0x560A, 0x5634, 0x5645, 0x5648, 0x5670, 0x573E, 0x588C, 0x58DE,
+    0x58E1, 0x5966, 0x59CD, 0x5A17, 0x5B19, 0x5C95, 0x5DC3, 0x5DD0,
+    0x5F10, 0x6079, 0x614B, 0x61C0, 0x61DC, 0x61FB, 0x6261, 0x629D,
+    0x62E6, 0x63A1, 0x63AC, 0x63C3, 0x63F9, 0x643E, 0x647A, 0x6485,
+    0x64A7, 0x6588, 0x660D, 0x66A7, 0x66B7, 0x66ED, 0x67F6, 0x69DD,
+    0x6B76, 0x6BAC, 0x6BAD, 0x6C80, 0x6CB1, 0x6D3E, 0x6DB6, 0x6DFE,
+    0x6E35, 0x6FE0, 0x70D9, 0x71F1, 0x7339, 0x7368, 0x7422, 0x74B0,
+    0x7585, 0x75D1, 0x76D3, 0x7768, 0x77A2, 0x77D3, 0x7806, 0x788A,
+    0x78A8, 0x78C9, 0x7930, 0x7938, 0x79B3, 0x7A16, 0x7A25, 0x7B2C,
+    0x7BBD, 0x7BC5, 0x7D9D, 0x7DBD, 0x7E8E, 0x7EA8, 0x7F25, 0x8024,
+    0x805B, 0x80A3, 0x80AD, 0x80E2, 0x81DC, 0x81EF, 0x8384, 0x83E1,
+    0x8420, 0x84AC, 0x8617, 0x8633, 0x867A, 0x86AE, 0x8737, 0x88AE,
+    0x88B2, 0x891F, 0x89F8, 0x8A4D, 0x8ABC, 0x8AE6, 0x8B45, 0x8C86,
+    0x8F30, 0x8FA3, 0x90C0, 0x912C, 0x9149, 0x925E, 0x92BE, 0x939B,
+    0x93C6, 0x94E6, 0x969B, 0x96AA, 0x96C7, 0x96D2, 0x97FC, 0x98AB,
+    0x98BF, 0x9A03, 0x9A23, 0x9A33, 0x9A65, 0x9A87, 0x9B89, 0x9B8B,
+    0x9BFA, 0x9C1B, 0x9C39, 0x9D45, 0x9D7F, 0x9E17, 0x9E18, 0x9ECB,
+    0xA00F, 0xA075, 0xA16E, 0xA286, 0xA381, 0xA394, 0xA3A6, 0xA3AC,
+    0xA3C8, 0xA3DD, 0xA3F8, 0xA46E, 0xA518, 0xA54B, 0xA7FC, 0xA995,
+    0xA9A0, 0xA9B5, 0xA9F2, 0xAA5D, 0xAB21, 0xAB64, 0xAD4E, 0xADFD,
+    0xAE14, 0xAE7B, 0xAEFD, 0xAF5E, 0xB040, 0xB09A, 0xB0CE, 0xB246,
+    0xB287, 0xB2BE, 0xB2F8, 0xB3C2, 0xB3D4, 0xB4D6, 0xB507, 0xB53B,
+    0xB552, 0xB69C, 0xB723, 0xB771, 0xB77C, 0xB7BF, 0xB894, 0xB902,
+    0xBA08, 0xBB11, 0xBB1D, 0xBBF8, 0xBC3E, 0xBCB3, 0xBDB9, 0xBE88,
+    0xBEB2, 0xBF8C, 0xC08B, 0xC124, 0xC12D, 0xC16C, 0xC2A6, 0xC2AC,
+    0xC306, 0xC328, 0xC456, 0xC4B6, 0xC4D1, 0xC4DB, 0xC53C, 0xC5B2,
+    0xC5C5, 0xC6BC, 0xC6D8, 0xC77B, 0xC8B9, 0xC911, 0xCAED, 0xCBB8,
+    0xCC06, 0xCD07, 0xCD20, 0xCD8F, 0xCDC1, 0xCDC3, 0xCEE4, 0xCF0B,
+    0xCFA7, 0xD056, 0xD06B, 0xD07F, 0xD15E, 0xD1EA, 0xD3AB, 0xD427,
+    0xD467, 0xD498, 0xD4FD, 0xD538, 0xD609, 0xD656, 0xD710, 0xD786,
+    0xD7F2, 0xD853, 0xD92C, 0xD9C8, 0xDA3B, 0xDA4D, 0xDA52, 0xDA61,
+    0xDA8A, 0xDACC, 0xDC64, 0xDCED, 0xDD33, 0xDD42, 0xDF30, 0xDFE9,
+    0xE25C, 0xE28E, 0xE291, 0xE2E7, 0xE363, 0xE430, 0xE563, 0xE65A,
+    0xE6A5, 0xE6EF, 0xE721, 0xE76C, 0xE84F, 0xEAF9, 0xEB93, 0xEC53,
+    0xED21, 0xEDB9, 0xEF10, 0xEF68, 0xF053, 0xF09C, 0xF0D9, 0xF13C,
+    0xF198, 0xF1BB, 0xF1E8, 0xF223, 0xF239, 0xF35B, 0xF3EE, 0xF42D,
+    0xF5BA, 0xF635, 0xF6B2, 0xF781, 0xF79A, 0xF7BF, 0xF834, 0xF857,
+    0xF907, 0xF96E, 0xF9E8, 0xFA2A, 0xFA6E, 0xFB3A, 0xFB4B, 0xFDAA,
+    0xFE3A,
+};
+
+// Frequency class of each hash (0 = most frequent), four per byte
+static const uint8_t WORD_TABLE_CLASSES[(WORD_TABLE_SIZE + 3) / 4] = {
+    0x21, 0x99, 0x41, 0x05, 0x65, 0x45, 0xA0, 0x94, 0x85, 0x86, 0x15, 0x59,
+    0x64, 0xA4, 0x94, 0x64, 0x89, 0x0A, 0x56, 0x45, 0x44, 0xA9, 0x40, 0x9A,
+    0x52, 0x68, 0x5A, 0x19, 0x90, 0x59, 0xA9, 0x64, 0x20, 0x25, 0x98, 0x66,
+    0x28, 0xA4, 0x19, 0xA5, 0x96, 0x98, 0x25, 0x05, 0x45, 0x41, 0x55, 0x01,
+    0xAA, 0x54, 0x26, 0x94, 0x41, 0x11, 0x55, 0x92, 0x25, 0xA9, 0x60, 0x59,
+    0x86, 0x85, 0xA6, 0x24, 0x58, 0xA9, 0x12, 0x5A, 0x6A, 0x49, 0x60, 0x12,
+    0x62, 0x15, 0x69, 0x69, 0x06, 0x25, 0x15, 0x02, 0x21, 0x28, 0x51, 0x44,
+    0x00, 0x65, 0x50, 0x91, 0x05, 0x25, 0x95, 0x05, 0x52, 0x46, 0x25, 0x62,
+    0x56, 0x51, 0x64, 0x40, 0x05, 0xA0, 0x56, 0x5A, 0x08, 0x45, 0x40, 0x44,
+    0x52, 0x64, 0x02,
+};
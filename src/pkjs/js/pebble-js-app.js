@@ -15,7 +15,6 @@ var DEFAULT_FEEDS = [
 var KEY_NEWS_TITLE = 172;
 var KEY_REQUEST_NEWS = 173;
 var KEY_NEWS_FEED_URL = 175;
-var KEY_NEWS_CHANNEL_TITLE = 176;
 var KEY_READING_SPEED_WPM = 177;
 var KEY_CONFIG_OPENED = 178;
 var KEY_CONFIG_RECEIVED = 179;
@@ -26,14 +25,115 @@ var KEY_FEED_NAME = 183;
 var KEY_REQUEST_FEEDS = 184;
 var KEY_SELECT_FEED = 185;
 var KEY_FEEDS_COUNT = 186;
+var KEY_NEWS_TITLES = 187;
+var KEY_ARTICLE_INDEX = 188;
+var KEY_ARTICLE_SEQ = 189;
+var KEY_ARTICLE_DONE = 190;
+var KEY_PERF_REPORT = 191;
+var KEY_INBOX_SIZE = 192;
+var KEY_NEWS_SEQ = 193;    // Sequence number of a title batch
+var KEY_NEWS_ACK = 194;    // Watch: next title batch it expects
+var KEY_NEWS_WINDOW = 195; // Watch: batches it accepts past the ack
+var KEY_ARTICLE_URGENT = 196; // Watch: the user is waiting for the chunk
+var KEY_FEED_LIST = 197;      // Feed names, each NUL-terminated
+var KEY_FEED_LIST_HASH = 198; // Hash of the feed list bytes
+var KEY_CHUNK_WIDTH = 199;    // Max width of a multi-word flash, 0 = off
+
+// Outgoing messages go through one queue, one message in flight, lowest
+// priority number first
+var PRIORITY_CONFIG = 0;   // Config page signals
+var PRIORITY_ARTICLE = 1;  // Article chunk the user is waiting for
+var PRIORITY_TITLES = 2;   // Headline stream
+var PRIORITY_PREFETCH = 3; // Article chunk fetched ahead
+var PRIORITY_FEEDS = 4;    // Feed list
+var SEND_ATTEMPTS = 4;     // Tries per message before giving up
+var SEND_BACKOFF_MS = 100; // Wait before the first retry, doubled each time
+
+// Messages are sized to the watch's inbox, which it sends with the feed
+// selection; until then assume the smallest one (aplite)
+var DEFAULT_INBOX_SIZE = 512;
+var TITLE_MESSAGE_OVERHEAD = 32;   // Dictionary header and tuple header
+var ARTICLE_MESSAGE_OVERHEAD = 64; // Must match ARTICLE_MESSAGE_OVERHEAD on the watch
+
+// Title batches: [length byte][packed bytes]... with a zero length ending the feed.
+// They are pushed with sequence numbers, at most the watch's window of them
+// past its last ack; a repeated ack asks for everything after it again.
+var NEWS_WINDOW = 2;     // Must match NEWS_WINDOW on the watch
+var MAX_ITEMS = 64;           // Watch keeps at most 64 titles
+var MAX_TITLE_BYTES = 159;    // Must match MAX_TITLE_LEN on the watch
+
+// The feed list goes in one message and must fit the watch's feed pool
+var MAX_FEEDS = 24;            // Must match MAX_FEEDS on the watch
+var MAX_FEED_NAME_BYTES = 47;  // Must match MAX_FEED_NAME_LEN on the watch
+var FEED_LIST_MAX_BYTES = 384; // Must match FEED_POOL_SIZE on the watch
+
+// Articles are streamed in fixed-size chunks: chunk N covers bytes
+// [N * size, (N + 1) * size) of the UTF-8 text, packed on its own, where size
+// is the watch's inbox size less ARTICLE_MESSAGE_OVERHEAD
+
+// Titles and article chunks are packed: bytes that never occur in news text
+// stand for dictionary entries (see unpack_text() on the watch). The first
+// entries get the one-byte codes below, the rest TEXT_PACK_ESCAPE and a byte.
+var TEXT_PACK_ESCAPE = 0xFF;
+var TEXT_SHORT_CODES = [
+  0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11,
+  0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+  0xC0, 0xC1, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE
+];
+// Frequent English and French words and word pieces, at most 8 UTF-8 bytes.
+// Must match s_text_dict in rsvp_text.c
+var TEXT_DICT = [
+  // One-byte codes
+  ' the', ' de ', 'tion', ' and', ' to ', ' of ', ' la ', ' le ', ' in ', 'ing ', 'ing', ' a ',
+  'es ', 'ed ', 'er ', 'e ', 's ', 't ', 'd ', ', ', '. ', ' et ', ' les', ' des', ' du ',
+  ' en ', ' un', ' is ', 'ent', 're', 'er', 'on', 'an', 'th', 'in', 'ou', 'qu', 'es', 'or',
+  '\u00E9',
+  // Two-byte codes: TEXT_PACK_ESCAPE and the entry number minus 40
+  ' that', ' for ', ' with', ' was ', ' on ', ' are ', ' as ', ' his ', ' they', ' be ', ' at ',
+  ' one', ' have', ' this', ' from', ' by ', ' had ', ' not ', ' but ', ' what', ' all ',
+  ' were', ' when', ' we ', ' there', ' can', ' said', ' which', ' their', ' will', ' would',
+  ' about', ' more', ' new ', ' has ', ' after', ' been', ' over', ' year', ' people', ' first',
+  ' also', ' could', ' into', ' other', ' than', ' its ', ' who ', ' against', ' between',
+  ' percent', ' million', ' billion', ' police', ' state', ' world', ' week', ' told', ' says',
+  ' report', ' company', ' during', ' before', ' while', ' three', ' two ', ' some', ' out ',
+  ' up ', ' it ', ' an ', ' or ', ' he ', ' she ', ' her ', ' you', ' just', ' only', ' most',
+  ' time', ' may ', ' under', ' where', ' because', ' last', ' officia', ' governm', ' preside',
+  ' pour', ' que ', ' qui ', ' dans', ' sur ', ' par ', ' pas ', ' est ', ' plus', ' avec',
+  ' une ', ' au ', ' aux ', ' il ', ' elle', ' ont ', ' \u00E9t\u00E9', ' ses ', ' son ',
+  ' sa ', ' ce ', ' cette', ' mais', ' comme', ' aussi', ' selon', ' apr\u00E8s', ' entre',
+  ' leur', ' sont', ' fait', ' \u00EAtre', ' avait', ' contre', ' depuis', ' deux', ' trois',
+  ' ans ', ' ann\u00E9e', ' tout', ' tous', ' m\u00EAme', ' encore', ' ne ', ' se ', ' lors',
+  ' dont', ' sans', ' nous', ' ils ', ' \u00E0 ', ' l\'', ' d\'', ' l\u2019', ' d\u2019',
+  '\u2019s ', '\'s ', '\u2019', '\u00AB ', ' \u00BB', '\u201C', '\u201D', ' \u2014 ', 'ment ',
+  'ment', 'tions', 'ation', 'ement', 'ique', 'ness', 'ally', 'ould', 'ight', 'ers ', 'ies ',
+  'eur', 'ait ', 'ant ', 'ons ', 'ions', 'ted ', 'ter', 'ate', 'ion', 'ere', 'ver', 'all',
+  'con', 'pro', 'com', 'ure', 'ous', 'ell', 'ess', 'est', 'ist', 'res', 'men', 'ien', 'ait',
+  ' The ', ' Le ', ' La ', ' Les ', ' Il ', ' In ', ' A ', ' Un', 'The ', 'Le ', 'La ', 'Les '
+];
+
+// Feed cache: parsed items per feed URL in localStorage, served at once and
+// revalidated with a conditional GET once the feed's own TTL has expired
+var FEED_CACHE_PREFIX = 'feed_cache:';
+var FEED_CACHE_INDEX = 'feed_cache_index'; // Cached URLs, most recent first
+var FEED_CACHE_MAX_FEEDS = 4;
+var DEFAULT_TTL_MINUTES = 15;
+var MAX_TTL_MINUTES = 24 * 60;
+var LAST_FEED_URL_KEY = 'last_feed_url';
+var UPDATE_PERIOD_MINUTES = { hourly: 60, daily: 1440, weekly: 10080, monthly: 43200, yearly: 525600 };
 
 // State
-var g_items = [];        // Array of {title: string, description: string}
-var g_current_index = 0;
-var g_channel_title = '';
+var g_items = [];        // Array of {title, description, guid, pubDate}
+var g_titles = null;     // {batches, next, acked, window, sending}: title stream
 var g_feeds = [];        // Array of {name: string, url: string}
 var g_selected_feed_index = 0;
-var g_feeds_sent_index = 0;
+var g_article = { index: -1, bytes: [], chunkBytes: 0 }; // Article being streamed
+var g_inbox_size = DEFAULT_INBOX_SIZE;
+var g_send_queue = [];   // Messages waiting, see queueMessage
+var g_send_busy = false; // A message is in flight or waiting to be retried
+var g_selection = 0;     // Bumped on every feed selection
+var g_speculative = null; // {url, feed, selection}: last feed loaded at 'ready'
+var g_feed_load = null;  // {url, selection, pending}: load of the selected feed
+var g_packing = null;    // Bytes and send time of the feed load, see packedSent
 
 // Load feeds from localStorage or use defaults
 function loadFeeds() {
@@ -66,387 +166,919 @@ function getRssUrl() {
   return DEFAULT_FEEDS[0].url;
 }
 
-// Decode HTML entities
-function decodeHtmlEntities(text) {
-  if (!text) return '';
-
-  var decoded = text;
-  decoded = decoded.replace(/&amp;/g, '&');
-  decoded = decoded.replace(/&lt;/g, '<');
-  decoded = decoded.replace(/&gt;/g, '>');
-  decoded = decoded.replace(/&quot;/g, '"');
-  decoded = decoded.replace(/&#39;/g, "'");
-  decoded = decoded.replace(/&apos;/g, "'");
-  decoded = decoded.replace(/&nbsp;/g, ' ');
-  decoded = decoded.replace(/&#8217;/g, "'");
-  decoded = decoded.replace(/&#8220;/g, '"');
-  decoded = decoded.replace(/&#8221;/g, '"');
-  decoded = decoded.replace(/&#8211;/g, '-');
-  decoded = decoded.replace(/&#8212;/g, '-');
-  decoded = decoded.replace(/&#160;/g, ' ');
-  decoded = decoded.replace(/&rsquo;/g, "'");
-  decoded = decoded.replace(/&lsquo;/g, "'");
-  decoded = decoded.replace(/&rdquo;/g, '"');
-  decoded = decoded.replace(/&ldquo;/g, '"');
-  decoded = decoded.replace(/&mdash;/g, '-');
-  decoded = decoded.replace(/&ndash;/g, '-');
-
-  // French accented characters
-  decoded = decoded.replace(/&eacute;/g, 'é');
-  decoded = decoded.replace(/&#233;/g, 'é');
-  decoded = decoded.replace(/&egrave;/g, 'è');
-  decoded = decoded.replace(/&#232;/g, 'è');
-  decoded = decoded.replace(/&ecirc;/g, 'ê');
-  decoded = decoded.replace(/&#234;/g, 'ê');
-  decoded = decoded.replace(/&euml;/g, 'ë');
-  decoded = decoded.replace(/&#235;/g, 'ë');
-  decoded = decoded.replace(/&agrave;/g, 'à');
-  decoded = decoded.replace(/&#224;/g, 'à');
-  decoded = decoded.replace(/&acirc;/g, 'â');
-  decoded = decoded.replace(/&#226;/g, 'â');
-  decoded = decoded.replace(/&auml;/g, 'ä');
-  decoded = decoded.replace(/&#228;/g, 'ä');
-  decoded = decoded.replace(/&ugrave;/g, 'ù');
-  decoded = decoded.replace(/&#249;/g, 'ù');
-  decoded = decoded.replace(/&ucirc;/g, 'û');
-  decoded = decoded.replace(/&#251;/g, 'û');
-  decoded = decoded.replace(/&uuml;/g, 'ü');
-  decoded = decoded.replace(/&#252;/g, 'ü');
-  decoded = decoded.replace(/&ocirc;/g, 'ô');
-  decoded = decoded.replace(/&#244;/g, 'ô');
-  decoded = decoded.replace(/&ouml;/g, 'ö');
-  decoded = decoded.replace(/&#246;/g, 'ö');
-  decoded = decoded.replace(/&icirc;/g, 'î');
-  decoded = decoded.replace(/&#238;/g, 'î');
-  decoded = decoded.replace(/&iuml;/g, 'ï');
-  decoded = decoded.replace(/&#239;/g, 'ï');
-  decoded = decoded.replace(/&ccedil;/g, 'ç');
-  decoded = decoded.replace(/&#231;/g, 'ç');
-  decoded = decoded.replace(/&aelig;/g, 'æ');
-  decoded = decoded.replace(/&#230;/g, 'æ');
-  decoded = decoded.replace(/&oelig;/g, 'œ');
-  decoded = decoded.replace(/&#339;/g, 'œ');
-
-  // Capital accented characters
-  decoded = decoded.replace(/&Eacute;/g, 'É');
-  decoded = decoded.replace(/&#201;/g, 'É');
-  decoded = decoded.replace(/&Egrave;/g, 'È');
-  decoded = decoded.replace(/&#200;/g, 'È');
-  decoded = decoded.replace(/&Ecirc;/g, 'Ê');
-  decoded = decoded.replace(/&#202;/g, 'Ê');
-  decoded = decoded.replace(/&Agrave;/g, 'À');
-  decoded = decoded.replace(/&#192;/g, 'À');
-  decoded = decoded.replace(/&Acirc;/g, 'Â');
-  decoded = decoded.replace(/&#194;/g, 'Â');
-  decoded = decoded.replace(/&Ccedil;/g, 'Ç');
-  decoded = decoded.replace(/&#199;/g, 'Ç');
-
-  return decoded;
-}
-
-// Send channel title to Pebble
-function sendNewsChannelTitle() {
-  if (!g_channel_title || g_channel_title.trim() === '') {
-    return;
+// Named HTML entities by code point: the Latin-1 set (&nbsp; to &yuml;,
+// code points 160-255 in order) plus the other names feeds commonly use
+var LATIN1_ENTITY_NAMES = ('nbsp iexcl cent pound curren yen brvbar sect uml copy ordf laquo not shy ' +
+  'reg macr deg plusmn sup2 sup3 acute micro para middot cedil sup1 ordm raquo frac14 frac12 ' +
+  'frac34 iquest Agrave Aacute Acirc Atilde Auml Aring AElig Ccedil Egrave Eacute Ecirc Euml ' +
+  'Igrave Iacute Icirc Iuml ETH Ntilde Ograve Oacute Ocirc Otilde Ouml times Oslash Ugrave ' +
+  'Uacute Ucirc Uuml Yacute THORN szlig agrave aacute acirc atilde auml aring aelig ccedil ' +
+  'egrave eacute ecirc euml igrave iacute icirc iuml eth ntilde ograve oacute ocirc otilde ' +
+  'ouml divide oslash ugrave uacute ucirc uuml yacute thorn yuml').split(' ');
+var ENTITY_CODES = {
+  amp: 38, lt: 60, gt: 62, quot: 34, apos: 39, OElig: 338, oelig: 339, Scaron: 352,
+  scaron: 353, Yuml: 376, ensp: 8194, emsp: 8195, thinsp: 8201, ndash: 8211, mdash: 8212,
+  lsquo: 8216, rsquo: 8217, sbquo: 8218, ldquo: 8220, rdquo: 8221, bdquo: 8222, bull: 8226,
+  hellip: 8230, prime: 8242, euro: 8364, trade: 8482
+};
+
+// Entity code points shown as plain ASCII (or dropped) on the watch
+var ENTITY_FOLDS = {
+  160: ' ', 173: '', 8194: ' ', 8195: ' ', 8201: ' ', 8211: '-', 8212: '-', 8216: "'",
+  8217: "'", 8218: "'", 8220: '"', 8221: '"', 8222: '"', 8242: "'"
+};
+
+var MAX_ENTITY_LENGTH = 10; // Longest entity body between '&' and ';'
+var DECIMAL_ENTITY = /^#([0-9]{1,7})$/;
+var HEX_ENTITY = /^#[xX]([0-9a-fA-F]{1,6})$/;
+var HTML_SPECIAL = /[&<>]/g;
+
+// Text of a code point, folded for the watch
+function codePointText(code) {
+  var fold = ENTITY_FOLDS[code];
+  if (fold !== undefined) {
+    return fold;
   }
+  if (code > 0xFFFF) {
+    code -= 0x10000;
+    return String.fromCharCode(0xD800 + (code >> 10), 0xDC00 + (code & 0x3FF));
+  }
+  return String.fromCharCode(code);
+}
 
-  console.log('Sending channel title: ' + g_channel_title);
-  var dict = {};
-  dict[KEY_NEWS_CHANNEL_TITLE] = g_channel_title;
-  Pebble.sendAppMessage(dict, function () {
-    console.log('Channel title sent successfully');
+// Decoded text of every named entity, built once
+var ENTITY_TEXT = Object.create(null);
+(function () {
+  for (var i = 0; i < LATIN1_ENTITY_NAMES.length; i++) {
+    ENTITY_TEXT[LATIN1_ENTITY_NAMES[i]] = codePointText(160 + i);
+  }
+  for (var name in ENTITY_CODES) {
+    ENTITY_TEXT[name] = codePointText(ENTITY_CODES[name]);
+  }
+})();
+
+// Text of the entity body between '&' and ';', or null if it isn't one
+function decodeEntity(body) {
+  if (body.charCodeAt(0) !== 35) { // '#'
+    var text = ENTITY_TEXT[body];
+    return text !== undefined ? text : null;
+  }
+  var match = DECIMAL_ENTITY.exec(body);
+  var code = match ? parseInt(match[1], 10) : 0;
+  if (!match) {
+    match = HEX_ENTITY.exec(body);
+    code = match ? parseInt(match[1], 16) : 0;
+  }
+  if (code === 0 || code > 0x10FFFF) {
+    return null;
+  }
+  return codePointText(code);
+}
+
+// Decode entities and, if stripTags is set, drop tags in the same scan. A
+// tag counts whether its brackets are literal or entities (&lt;p&gt;, common
+// in descriptions); a '<' with no '>' after it is kept as text.
+function decodeHtml(text, stripTags) {
+  if (text.indexOf('&') < 0 && text.indexOf('<') < 0) {
+    return text;
+  }
+
+  var out = '';
+  var copied = 0;    // Source text before this is in out or dropped
+  var tagStart = -1; // Source index of the open tag, -1 outside tags
+  var special;
+
+  HTML_SPECIAL.lastIndex = 0;
+  while ((special = HTML_SPECIAL.exec(text)) !== null) {
+    var i = special.index;
+    var c = text.charCodeAt(i);
+    var next = i + 1;
+    var decoded = null;
+    if (c === 38) { // '&'
+      var semi = text.indexOf(';', next);
+      if (semi > next && semi - next <= MAX_ENTITY_LENGTH) {
+        decoded = decodeEntity(text.substring(next, semi));
+        if (decoded !== null) {
+          next = semi + 1;
+          c = decoded === '<' ? 60 : decoded === '>' ? 62 : 0;
+        }
+      }
+    }
+
+    if (stripTags && c === 60 && tagStart < 0) { // '<'
+      out += text.substring(copied, i);
+      tagStart = i;
+    } else if (stripTags && c === 62 && tagStart >= 0) { // '>'
+      tagStart = -1;
+      copied = next;
+    } else if (decoded !== null && tagStart < 0) {
+      out += text.substring(copied, i) + decoded;
+      copied = next;
+    }
+    HTML_SPECIAL.lastIndex = next;
+  }
+
+  if (tagStart >= 0) {
+    return out + decodeHtml(text.substring(tagStart), false);
+  }
+  return out + text.substring(copied);
+}
+
+// Queue a message for the watch. message is {label, dict, priority, and
+// optionally coalesce, sent(flightMs), failed()}; a waiting message with the
+// same coalesce key is replaced rather than sent twice.
+function queueMessage(message) {
+  message.queued = Date.now();
+  message.attempts = 0;
+  if (message.coalesce) {
+    for (var i = 0; i < g_send_queue.length; i++) {
+      if (g_send_queue[i].coalesce === message.coalesce) {
+        console.log('Replacing queued ' + g_send_queue[i].label + ' with ' + message.label);
+        g_send_queue.splice(i, 1);
+        break;
+      }
+    }
+  }
+  g_send_queue.push(message);
+  sendQueuedMessage();
+}
+
+// Send the most urgent waiting message, oldest first within a priority
+function sendQueuedMessage() {
+  if (g_send_busy || g_send_queue.length === 0) {
+    return;
+  }
+  var best = 0;
+  for (var i = 1; i < g_send_queue.length; i++) {
+    if (g_send_queue[i].priority < g_send_queue[best].priority) {
+      best = i;
+    }
+  }
+  var message = g_send_queue.splice(best, 1)[0];
+
+  g_send_busy = true;
+  message.attempts++;
+  var start = Date.now();
+  Pebble.sendAppMessage(message.dict, function () {
+    var flightMs = Date.now() - start;
+    console.log('Sent ' + message.label + ' in ' + flightMs + ' ms (queued ' +
+      (start - message.queued) + ' ms' + (message.attempts > 1 ? ', attempt ' + message.attempts : '') + ')');
+    g_send_busy = false;
+    if (message.sent) {
+      message.sent(flightMs);
+    }
+    sendQueuedMessage();
   }, function (e) {
-    console.log('Failed to send channel title: ' + JSON.stringify(e));
+    console.log('Failed to send ' + message.label + ': ' + JSON.stringify(e));
+    if (message.attempts >= SEND_ATTEMPTS) {
+      g_send_busy = false;
+      if (message.failed) {
+        message.failed();
+      }
+      sendQueuedMessage();
+      return;
+    }
+    // Retry after a backoff; it goes out before anything of lower priority,
+    // unless a newer message replaced it meanwhile
+    g_send_queue.unshift(message);
+    setTimeout(function () {
+      g_send_busy = false;
+      sendQueuedMessage();
+    }, SEND_BACKOFF_MS << (message.attempts - 1));
   });
 }
 
-// Fetch and parse RSS feed
-function fetchRssFeed() {
-  var rssUrl = getRssUrl();
+// Load the cached entry of a feed, or null
+function loadFeedCache(url) {
+  var stored = localStorage.getItem(FEED_CACHE_PREFIX + url);
+  if (!stored) {
+    return null;
+  }
+  try {
+    var entry = JSON.parse(stored);
+    if (entry && Array.isArray(entry.items)) {
+      return entry;
+    }
+  } catch (e) {
+    console.log('Dropping corrupt feed cache: ' + e.message);
+  }
+  return null;
+}
+
+// Save the cached entry of a feed, evicting the least recently used feeds
+function saveFeedCache(url, entry) {
+  var index = [];
+  try {
+    index = JSON.parse(localStorage.getItem(FEED_CACHE_INDEX)) || [];
+  } catch (e) {
+    index = [];
+  }
+  index = index.filter(function (cachedUrl) { return cachedUrl !== url; });
+  index.unshift(url);
+  while (index.length > FEED_CACHE_MAX_FEEDS) {
+    localStorage.removeItem(FEED_CACHE_PREFIX + index.pop());
+  }
+
+  try {
+    localStorage.setItem(FEED_CACHE_PREFIX + url, JSON.stringify(entry));
+    localStorage.setItem(FEED_CACHE_INDEX, JSON.stringify(index));
+  } catch (e) {
+    console.log('Failed to cache feed: ' + e.message);
+  }
+}
+
+// Minutes a feed stays fresh, from the channel's <ttl> or
+// sy:updatePeriod/sy:updateFrequency
+function feedTtlMinutes(channel) {
+  var minutes = 0;
+  if (channel.ttl) {
+    minutes = parseInt(channel.ttl);
+  } else if (channel.updatePeriod) {
+    var frequency = Math.max(1, parseInt(channel.updateFrequency) || 1);
+    minutes = (UPDATE_PERIOD_MINUTES[channel.updatePeriod.trim().toLowerCase()] || 0) / frequency;
+  }
+  if (!(minutes > 0)) {
+    minutes = DEFAULT_TTL_MINUTES;
+  }
+  return Math.min(minutes, MAX_TTL_MINUTES);
+}
+
+// Cheap fingerprint of a response, to skip parsing a feed that came back
+// unchanged from a server without validators
+function hashText(text) {
+  var hash = 5381;
+  for (var i = 0; i < text.length; i++) {
+    hash = ((hash << 5) + hash + text.charCodeAt(i)) | 0;
+  }
+  return hash;
+}
+
+// Start sending a feed's items to the watch
+function showFeedItems(channel, items) {
+  // The watch has no use for the channel title, so it is only logged
+  if (channel) {
+    console.log('Channel title: ' + channel);
+  }
+  g_items = items;
+  g_packing = { raw: 0, packed: 0, sentBytes: 0, sendMs: 0 };
+  if (g_items.length > 0) {
+    // The feed selection opens the window
+    g_titles = { batches: buildTitleBatches(), next: 0, acked: 0, window: NEWS_WINDOW, sending: false };
+    sendTitleBatches();
+  } else {
+    console.log('No valid items found in RSS feed');
+  }
+}
+
+// Load a feed and call onItems(channel, items) once: from the cache when
+// there is a copy, otherwise from the network. onError, if given, is called
+// instead when there is no copy and the request fails
+function loadFeed(rssUrl, onItems, onError) {
+  var cached = loadFeedCache(rssUrl);
+  if (cached) {
+    var age = Date.now() - cached.fetched;
+    console.log('Serving cached feed (' + Math.round(age / 1000) + 's old, ttl ' +
+      cached.ttl + ' min)');
+    onItems(cached.channel, cached.items);
+    if (age < cached.ttl * 60000) {
+      return;
+    }
+  }
   console.log('Fetching RSS feed from: ' + rssUrl);
 
   var xhr = new XMLHttpRequest();
   xhr.open('GET', rssUrl, true);
   xhr.setRequestHeader('Content-Type', 'text/xml; charset=UTF-8');
+  if (cached && cached.etag) {
+    xhr.setRequestHeader('If-None-Match', cached.etag);
+  }
+  if (cached && cached.lastModified) {
+    xhr.setRequestHeader('If-Modified-Since', cached.lastModified);
+  }
 
   xhr.onload = function () {
     if (xhr.readyState === 4) {
-      if (xhr.status === 200) {
+      if (xhr.status === 304 && cached) {
+        console.log('RSS feed not modified');
+        cached.fetched = Date.now();
+        saveFeedCache(rssUrl, cached);
+      } else if (xhr.status === 200) {
         console.log('RSS feed fetched successfully');
-        parseRssFeed(xhr.responseText);
+        var hash = hashText(xhr.responseText);
+        var entry;
+        if (cached && cached.hash === hash) {
+          console.log('RSS feed unchanged, skipping parse');
+          entry = cached;
+        } else {
+          var feed = parseRssFeed(xhr.responseText);
+          entry = { channel: feed.channel, items: feed.items, ttl: feed.ttl, hash: hash };
+        }
+        entry.etag = xhr.getResponseHeader('ETag') || '';
+        entry.lastModified = xhr.getResponseHeader('Last-Modified') || '';
+        entry.fetched = Date.now();
+        if (entry.items.length > 0) {
+          saveFeedCache(rssUrl, entry);
+        }
+        // A stale copy already being read keeps its place for this session,
+        // so article indices stay in step with the watch; the fresh one is
+        // served on the next selection
+        if (!cached) {
+          onItems(entry.channel, entry.items);
+        }
       } else {
         console.log('Request failed with status: ' + xhr.status);
+        if (!cached && onError) {
+          onError();
+        }
       }
     }
   };
 
   xhr.onerror = function () {
     console.log('Network error while fetching RSS feed');
+    if (!cached && onError) {
+      onError();
+    }
   };
 
   xhr.send();
 }
 
-// Parse RSS XML
+// Fetch and parse the selected feed, using the speculative load started at
+// 'ready' when it is for the same feed
+function fetchRssFeed() {
+  var rssUrl = getRssUrl();
+  var selection = ++g_selection;
+  localStorage.setItem(LAST_FEED_URL_KEY, rssUrl);
+  g_feed_load = { url: rssUrl, selection: selection, pending: true };
+
+  var speculative = g_speculative;
+  g_speculative = null;
+  if (speculative && speculative.url === rssUrl) {
+    speculative.selection = selection;
+    if (speculative.feed) {
+      console.log('Using prefetched feed');
+      feedLoadSettled(selection);
+      showFeedItems(speculative.feed.channel, speculative.feed.items);
+    } else {
+      console.log('Waiting for prefetched feed');
+    }
+    return;
+  }
+
+  loadSelectedFeed(rssUrl, selection);
+}
+
+// Load a feed for a menu selection, unless the user has moved on since
+function loadSelectedFeed(rssUrl, selection) {
+  if (g_feed_load && g_feed_load.selection === selection) {
+    g_feed_load.pending = true;
+  }
+  loadFeed(rssUrl, function (channel, items) {
+    if (selection === g_selection) {
+      feedLoadSettled(selection);
+      showFeedItems(channel, items);
+    }
+  }, function () {
+    feedLoadSettled(selection);
+  });
+}
+
+// The load of a selection has given items or failed
+function feedLoadSettled(selection) {
+  if (g_feed_load && g_feed_load.selection === selection) {
+    g_feed_load.pending = false;
+  }
+}
+
+// The watch timed out waiting for titles: load the selected feed again,
+// unless its load is still running (a slow network would otherwise restart
+// it on every timeout and never finish)
+function retrySelectedFeed() {
+  if (!g_feed_load || g_feed_load.selection !== g_selection) {
+    fetchRssFeed();
+  } else if (g_feed_load.pending) {
+    console.log('Feed still loading, waiting');
+  } else {
+    console.log('Loading feed again');
+    loadSelectedFeed(g_feed_load.url, g_feed_load.selection);
+  }
+}
+
+// Start loading the last used feed as soon as JS is ready, so its headlines
+// are parsed by the time the user picks it from the menu
+function prefetchLastFeed() {
+  var url = localStorage.getItem(LAST_FEED_URL_KEY);
+  var configured = g_feeds.filter(function (feed) { return feed.url === url; });
+  if (!url || configured.length === 0) {
+    return;
+  }
+
+  console.log('Prefetching last used feed: ' + url);
+  var speculative = { url: url, feed: null, selection: -1 };
+  g_speculative = speculative;
+  loadFeed(url, function (channel, items) {
+    speculative.feed = { channel: channel, items: items };
+    if (speculative.selection === g_selection) {
+      feedLoadSettled(speculative.selection);
+      showFeedItems(channel, items);
+    }
+  }, function () {
+    // Later selections load normally, and one already waiting on this load
+    // retries now rather than at the watch's timeout
+    if (g_speculative === speculative) {
+      g_speculative = null;
+    }
+    if (speculative.selection === g_selection) {
+      console.log('Prefetch failed, loading feed again');
+      loadSelectedFeed(url, speculative.selection);
+    }
+  });
+}
+
+// Item fields kept by the tokenizer, by lower-case element name
+var RSS_ITEM_FIELDS = { title: 'title', description: 'description', guid: 'guid', pubdate: 'pubDate' };
+// Channel fields, read before the first item
+var RSS_CHANNEL_FIELDS = { title: 'title', ttl: 'ttl', 'sy:updateperiod': 'updatePeriod', 'sy:updatefrequency': 'updateFrequency' };
+
+// Decode entities, drop markup and trim a field's text
+function cleanText(text) {
+  return decodeHtml(text, true).trim();
+}
+
+// Parse RSS XML into {channel, ttl, items} in one pass: the document is
+// walked tag by tag with indexOf, only the text of wanted fields is kept,
+// and parsing stops once MAX_ITEMS items are collected
 function parseRssFeed(xmlText) {
   console.log('Starting RSS parsing, text length: ' + xmlText.length);
 
-  try {
-    // Try DOMParser first
-    if (typeof DOMParser !== 'undefined') {
-      console.log('Using DOMParser');
-      var parser = new DOMParser();
-      var xmlDoc = parser.parseFromString(xmlText, 'text/xml');
-
-      var items = xmlDoc.getElementsByTagName('item');
-      console.log('Found ' + items.length + ' items in RSS feed');
-
-      // Get channel title
-      var channelElements = xmlDoc.getElementsByTagName('channel');
-      if (channelElements.length > 0) {
-        var titleElements = channelElements[0].getElementsByTagName('title');
-        if (titleElements.length > 0) {
-          g_channel_title = titleElements[0].textContent || '';
-          g_channel_title = decodeHtmlEntities(g_channel_title);
-          console.log('Channel title: ' + g_channel_title);
-          sendNewsChannelTitle();
+  var channel = {};
+  var items = [];
+  var item = null;      // Fields of the <item> being read
+  var fields = channel; // Where the current field is stored
+  var field = null;     // Property the text being collected belongs to
+  var fieldTag = '';    // Element whose end tag closes the field
+  var text = '';
+  var length = xmlText.length;
+  var pos = 0;
+
+  while (pos < length && items.length < MAX_ITEMS) {
+    var lt = xmlText.indexOf('<', pos);
+    if (lt < 0) {
+      break;
+    }
+    if (field !== null) {
+      text += xmlText.substring(pos, lt);
+    }
+
+    // CDATA sections are text; comments and declarations are skipped
+    if (xmlText.charCodeAt(lt + 1) === 33) { // '!'
+      if (xmlText.substr(lt, 9) === '<![CDATA[') {
+        var cdataEnd = xmlText.indexOf(']]>', lt + 9);
+        if (cdataEnd < 0) {
+          cdataEnd = length;
+        }
+        if (field !== null) {
+          text += xmlText.substring(lt + 9, cdataEnd);
         }
+        pos = cdataEnd + 3;
+      } else if (xmlText.substr(lt, 4) === '<!--') {
+        var commentEnd = xmlText.indexOf('-->', lt + 4);
+        pos = commentEnd < 0 ? length : commentEnd + 3;
+      } else {
+        var declarationEnd = xmlText.indexOf('>', lt + 2);
+        pos = declarationEnd < 0 ? length : declarationEnd + 1;
       }
+      continue;
+    }
 
-      // Parse items (title + description)
-      g_items = [];
-      for (var i = 0; i < items.length && i < 50; i++) {
-        var titleNode = items[i].getElementsByTagName('title')[0];
-        var descNode = items[i].getElementsByTagName('description')[0];
-
-        if (titleNode) {
-          var title = titleNode.textContent || '';
-          title = decodeHtmlEntities(title);
-          title = title.replace(/<[^>]*>/g, '');
-          title = title.trim();
-
-          var description = '';
-          if (descNode) {
-            description = descNode.textContent || '';
-            description = decodeHtmlEntities(description);
-            description = description.replace(/<[^>]*>/g, '');
-            description = description.trim();
-            if (description.length > 500) {
-              description = description.substring(0, 497) + '...';
-            }
-          }
-
-          if (title.length > 0) {
-            g_items.push({
-              title: title,
-              description: description
-            });
-          }
-        }
+    var gt = xmlText.indexOf('>', lt + 1);
+    if (gt < 0) {
+      break;
+    }
+    pos = gt + 1;
+
+    var closing = xmlText.charCodeAt(lt + 1) === 47; // '/'
+    var nameStart = closing ? lt + 2 : lt + 1;
+    var nameEnd = nameStart;
+    while (nameEnd < gt) {
+      var c = xmlText.charCodeAt(nameEnd);
+      if (c === 32 || c === 47 || c === 9 || c === 10 || c === 13) {
+        break;
       }
+      nameEnd++;
+    }
+    var name = xmlText.substring(nameStart, nameEnd).toLowerCase();
 
-      if (g_items.length > 0) {
-        console.log('Parsed ' + g_items.length + ' news items with DOMParser');
-        g_current_index = 0;
-        sendNextNewsItem();
-        return;
+    // Markup inside a field is dropped, like textContent would
+    if (field !== null) {
+      if (closing && name === fieldTag) {
+        fields[field] = text;
+        field = null;
       }
+      continue;
     }
-  } catch (e) {
-    console.log('DOMParser failed: ' + e.message);
-  }
-
-  // Fallback: use regex parsing
-  console.log('Using regex fallback parsing');
-  parseRssFeedWithRegex(xmlText);
-}
-
-// Fallback regex parser for RSS
-function parseRssFeedWithRegex(xmlText) {
-  g_items = [];
-
-  // Extract channel title
-  var channelTitleMatch = xmlText.match(/<channel[^>]*>[\s\S]*?<title[^>]*>([^<]+)<\/title>/i);
-  if (channelTitleMatch) {
-    g_channel_title = decodeHtmlEntities(channelTitleMatch[1].trim());
-    console.log('Channel title (regex): ' + g_channel_title);
-    sendNewsChannelTitle();
-  }
-
-  // Extract items using regex
-  var itemRegex = /<item[^>]*>([\s\S]*?)<\/item>/gi;
-  var titleRegex = /<title[^>]*>(?:<!\[CDATA\[)?([\s\S]*?)(?:\]\]>)?<\/title>/i;
-  var descRegex = /<description[^>]*>(?:<!\[CDATA\[)?([\s\S]*?)(?:\]\]>)?<\/description>/i;
-
-  var match;
-  var count = 0;
-  while ((match = itemRegex.exec(xmlText)) !== null && count < 50) {
-    var itemContent = match[1];
-
-    var titleMatch = itemContent.match(titleRegex);
-    if (titleMatch) {
-      var title = titleMatch[1];
-      title = decodeHtmlEntities(title);
-      title = title.replace(/<[^>]*>/g, '');
-      title = title.trim();
-
-      var description = '';
-      var descMatch = itemContent.match(descRegex);
-      if (descMatch) {
-        description = descMatch[1];
-        description = decodeHtmlEntities(description);
-        description = description.replace(/<[^>]*>/g, '');
-        description = description.trim();
-        if (description.length > 500) {
-          description = description.substring(0, 497) + '...';
+
+    if (name === 'item') {
+      if (!closing) {
+        item = {};
+        fields = item;
+      } else if (item) {
+        var title = cleanText(item.title || '');
+        if (title.length > 0) {
+          items.push({
+            title: title,
+            description: cleanText(item.description || ''),
+            guid: (item.guid || '').trim(),
+            pubDate: (item.pubDate || '').trim()
+          });
         }
+        item = null;
+        fields = channel;
       }
+      continue;
+    }
 
-      if (title.length > 0) {
-        g_items.push({
-          title: title,
-          description: description
-        });
-        count++;
-      }
+    // Collect the first occurrence of each wanted field
+    if (closing || xmlText.charCodeAt(gt - 1) === 47) {
+      continue;
+    }
+    var wanted = item ? RSS_ITEM_FIELDS[name] : RSS_CHANNEL_FIELDS[name];
+    if (wanted && fields[wanted] === undefined) {
+      field = wanted;
+      fieldTag = name;
+      text = '';
     }
   }
 
-  console.log('Parsed ' + g_items.length + ' news items with regex');
-  g_current_index = 0;
+  console.log('Parsed ' + items.length + ' news items');
+  return {
+    channel: cleanText(channel.title || ''),
+    ttl: feedTtlMinutes(channel),
+    items: items
+  };
+}
 
-  if (g_items.length > 0) {
-    sendNextNewsItem();
-  } else {
-    console.log('No valid items found in RSS feed');
+// Encode a string as an array of UTF-8 bytes
+function utf8Encode(text) {
+  var binary = unescape(encodeURIComponent(text));
+  var bytes = new Array(binary.length);
+  for (var i = 0; i < binary.length; i++) {
+    bytes[i] = binary.charCodeAt(i);
+  }
+  return bytes;
+}
+
+// Truncate UTF-8 bytes to a maximum length without splitting a character
+function truncateUtf8(bytes, maxBytes) {
+  if (bytes.length <= maxBytes) {
+    return bytes;
+  }
+  var end = maxBytes;
+  while (end > 0 && (bytes[end] & 0xC0) === 0x80) {
+    end--;
+  }
+  return bytes.slice(0, end);
+}
+
+// Dictionary entries by first byte, longest first, with their codes
+var TEXT_DICT_INDEX = {};
+(function () {
+  for (var i = 0; i < TEXT_DICT.length; i++) {
+    var bytes = utf8Encode(TEXT_DICT[i]);
+    var code = i < TEXT_SHORT_CODES.length ? [TEXT_SHORT_CODES[i]] :
+      [TEXT_PACK_ESCAPE, i - TEXT_SHORT_CODES.length];
+    var entries = TEXT_DICT_INDEX[bytes[0]] || (TEXT_DICT_INDEX[bytes[0]] = []);
+    entries.push({ bytes: bytes, code: code });
+  }
+  for (var first in TEXT_DICT_INDEX) {
+    TEXT_DICT_INDEX[first].sort(function (a, b) { return b.bytes.length - a.bytes.length; });
+  }
+})();
+
+// Pack UTF-8 bytes with the longest dictionary match at each position.
+// Control characters that are codes are sent as spaces.
+function packText(bytes) {
+  var packed = [];
+  var i = 0;
+  while (i < bytes.length) {
+    var entries = TEXT_DICT_INDEX[bytes[i]];
+    var match = null;
+    for (var e = 0; entries && e < entries.length && !match; e++) {
+      var entry = entries[e].bytes;
+      var k = 1;
+      while (k < entry.length && bytes[i + k] === entry[k]) {
+        k++;
+      }
+      if (k === entry.length && entries[e].code.length < entry.length) {
+        match = entries[e];
+      }
+    }
+
+    if (match) {
+      packed.push.apply(packed, match.code);
+      i += match.bytes.length;
+    } else {
+      var b = bytes[i++];
+      packed.push(b < 0x20 && b !== 9 && b !== 10 && b !== 13 ? 32 : b);
+    }
   }
+  return packed;
 }
 
-// Send next news item to Pebble
-function sendNextNewsItem() {
-  if (g_current_index >= g_items.length) {
-    console.log('All items sent');
-    g_current_index = 0;
+// Count packed bytes queued for the watch; returns the callback to call
+// with the time they were in flight once they are delivered
+function packedSent(rawBytes, packedBytes) {
+  var packing = g_packing;
+  if (packing) {
+    packing.raw += rawBytes;
+    packing.packed += packedBytes;
+  }
+  return function (flightMs) {
+    if (packing) {
+      packing.sentBytes += packedBytes;
+      packing.sendMs += flightMs;
+    }
+  };
+}
+
+// Log the compression ratio of the feed load so far and the transfer time it
+// saved, estimated from the measured time per delivered byte
+function logPacking(what) {
+  var packing = g_packing;
+  if (!packing || packing.raw === 0) {
     return;
   }
+  var msPerByte = packing.sentBytes > 0 ? packing.sendMs / packing.sentBytes : 0;
+  console.log('Packing after ' + what + ': ' + packing.raw + ' -> ' + packing.packed +
+    ' bytes (' + Math.round(100 * packing.packed / packing.raw) + '%), ~' +
+    Math.round((packing.raw - packing.packed) * msPerByte) + ' ms of transfer saved');
+}
 
-  var item = g_items[g_current_index];
-  console.log('Sending item ' + (g_current_index + 1) + ': ' + item.title);
+// Split the feed's titles into batches that fill the watch's inbox; the
+// last one ends with the end-of-feed marker
+function buildTitleBatches() {
+  var batches = [];
+  var batch = { bytes: [], rawBytes: 0, first: 0, end: 0 };
+  for (var next = 0; next < g_items.length; next++) {
+    var title = truncateUtf8(utf8Encode(g_items[next].title), MAX_TITLE_BYTES);
+    var bytes = packText(title);
+    if (batch.bytes.length + 1 + bytes.length > g_inbox_size - TITLE_MESSAGE_OVERHEAD) {
+      batches.push(batch);
+      batch = { bytes: [], rawBytes: 0, first: next, end: next };
+    }
+    batch.bytes.push(bytes.length);
+    for (var i = 0; i < bytes.length; i++) {
+      batch.bytes.push(bytes[i]);
+    }
+    batch.rawBytes += 1 + title.length;
+    batch.end = next + 1;
+  }
 
-  var dict = {};
-  dict[KEY_NEWS_TITLE] = item.title;
-  Pebble.sendAppMessage(dict, function () {
-    console.log('Message sent successfully');
-    g_current_index++;
-  }, function (e) {
-    console.log('Failed to send message: ' + JSON.stringify(e));
-  });
+  // The marker gets a batch of its own if the last one is full
+  if (batch.bytes.length + 1 > g_inbox_size - TITLE_MESSAGE_OVERHEAD) {
+    batches.push(batch);
+    batch = { bytes: [], rawBytes: 0, first: g_items.length, end: g_items.length };
+  }
+  batch.bytes.push(0);
+  batch.rawBytes++;
+  batches.push(batch);
+  return batches;
 }
 
-// Send feed names to Pebble (one at a time)
-function sendFeedNames() {
-  loadFeeds();
-  g_feeds_sent_index = 0;
+// Send title batches while the watch's window allows, one message at a time
+function sendTitleBatches() {
+  var stream = g_titles;
+  if (!stream || stream.sending || stream.next >= stream.batches.length ||
+      stream.next >= stream.acked + stream.window) {
+    return;
+  }
+
+  var seq = stream.next;
+  var batch = stream.batches[seq];
+  var last = seq === stream.batches.length - 1;
+  console.log('Queueing batch ' + seq + ': items ' + (batch.first + 1) + '-' + batch.end + ' of ' +
+    g_items.length + ' (' + batch.bytes.length + ' bytes)' + (last ? ', end of feed' : ''));
 
-  // First send the count
+  stream.sending = true;
+  var delivered = packedSent(batch.rawBytes, batch.bytes.length);
   var dict = {};
-  dict[KEY_FEEDS_COUNT] = g_feeds.length;
-  Pebble.sendAppMessage(dict, function () {
-    console.log('Feeds count sent: ' + g_feeds.length);
-    // Then send each feed name
-    sendNextFeedName();
-  }, function (e) {
-    console.log('Failed to send feeds count: ' + JSON.stringify(e));
+  dict[KEY_NEWS_TITLES] = batch.bytes;
+  dict[KEY_NEWS_SEQ] = seq;
+  queueMessage({
+    label: 'title batch ' + seq,
+    dict: dict,
+    priority: PRIORITY_TITLES,
+    coalesce: 'titles',
+    sent: function (flightMs) {
+      if (stream !== g_titles) {
+        return;
+      }
+      delivered(flightMs);
+      stream.sending = false;
+      if (stream.next === seq) {
+        stream.next = seq + 1; // Unless a repeated ack rewound the stream
+      }
+      if (last) {
+        logPacking('titles');
+      }
+      sendTitleBatches();
+    },
+    // Given up on: the watch's watchdog repeats its ack, which resends it
+    failed: function () {
+      stream.sending = false;
+    }
   });
 }
 
-function sendNextFeedName() {
-  if (g_feeds_sent_index >= g_feeds.length) {
-    console.log('All feed names sent');
+// The watch acknowledged the title batches before ack and accepts window
+// more. The same ack twice means it missed the batch after it: go back to it.
+function titlesAcked(ack, window) {
+  var stream = g_titles;
+  if (!stream) {
+    // Still nothing to send: the feed may have failed to load
+    if (g_items.length === 0) {
+      retrySelectedFeed();
+    }
     return;
   }
 
-  var feed = g_feeds[g_feeds_sent_index];
-  console.log('Sending feed name ' + g_feeds_sent_index + ': ' + feed.name);
+  if (ack <= stream.acked && ack < stream.next) {
+    console.log('Watch expects batch ' + ack + ' again');
+    stream.next = ack;
+  }
+  stream.next = Math.max(stream.next, ack); // A resent batch was already there
+  stream.acked = ack;
+  stream.window = window;
+  sendTitleBatches();
+}
 
+// The feed list as the watch stores it: each name NUL-terminated, as many
+// as its pool holds
+function feedListBytes() {
+  var bytes = [];
+  for (var i = 0; i < g_feeds.length && i < MAX_FEEDS; i++) {
+    var name = truncateUtf8(utf8Encode(g_feeds[i].name || ''), MAX_FEED_NAME_BYTES);
+    if (bytes.length + name.length + 1 > FEED_LIST_MAX_BYTES) {
+      console.log('Feed list full, ' + (g_feeds.length - i) + ' feeds left out');
+      break;
+    }
+    bytes = bytes.concat(name);
+    bytes.push(0);
+  }
+  return bytes;
+}
+
+// 32-bit FNV-1a hash of a byte array, as a signed int for the message
+function hashBytes(bytes) {
+  var hash = 0x811C9DC5;
+  for (var i = 0; i < bytes.length; i++) {
+    hash ^= bytes[i];
+    hash += (hash << 1) + (hash << 4) + (hash << 7) + (hash << 8) + (hash << 24);
+  }
+  return hash | 0;
+}
+
+// Tell the watch the feed list's hash; it asks for the list itself
+// (KEY_REQUEST_FEEDS) only when its cached copy differs
+function sendFeedListHash() {
+  loadFeeds();
   var dict = {};
-  dict[KEY_FEED_NAME] = feed.name;
-  Pebble.sendAppMessage(dict, function () {
-    console.log('Feed name sent successfully');
-    g_feeds_sent_index++;
-    // Send next feed name after a short delay
-    setTimeout(sendNextFeedName, 50);
-  }, function (e) {
-    console.log('Failed to send feed name: ' + JSON.stringify(e));
+  dict[KEY_FEED_LIST_HASH] = hashBytes(feedListBytes());
+  queueMessage({ label: 'feed list hash', dict: dict, priority: PRIORITY_FEEDS, coalesce: 'feeds' });
+}
+
+// Send the whole feed list in one message, behind any other traffic
+function sendFeedList() {
+  loadFeeds();
+  var bytes = feedListBytes();
+  var dict = {};
+  dict[KEY_FEED_LIST] = bytes;
+  dict[KEY_FEED_LIST_HASH] = hashBytes(bytes);
+  queueMessage({
+    label: 'feed list (' + bytes.length + ' bytes)',
+    dict: dict,
+    priority: PRIORITY_FEEDS,
+    coalesce: 'feeds'
   });
 }
 
-// Send article for a specific index to Pebble
-function sendArticle(index) {
+// Send one chunk of the article for a specific index to Pebble; urgent when
+// the user is waiting for it rather than it being fetched ahead
+function sendArticleChunk(index, seq, urgent) {
   if (index < 0 || index >= g_items.length) {
     console.log('Invalid article index: ' + index);
     return;
   }
 
-  var item = g_items[index];
-  var article = item.description || 'No article content available.';
-  console.log('Sending article for item ' + index + ' (' + article.length + ' chars)');
+  if (g_article.index !== index || seq === 0) {
+    var article = g_items[index].description || 'No article content available.';
+    g_article = {
+      index: index,
+      bytes: utf8Encode(article),
+      chunkBytes: g_inbox_size - ARTICLE_MESSAGE_OVERHEAD
+    };
+  }
+
+  var bytes = g_article.bytes;
+  var start = seq * g_article.chunkBytes;
+  var end = Math.min(start + g_article.chunkBytes, bytes.length);
+  var done = end >= bytes.length;
+  var packed = packText(bytes.slice(start, end));
+  console.log('Queueing article ' + index + ' chunk ' + seq + ' (bytes ' + start + '-' + end +
+    ' of ' + bytes.length + ', ' + packed.length + ' packed)' + (done ? ', last' : '') +
+    (urgent ? ', urgent' : ''));
 
+  var delivered = packedSent(end - start, packed.length);
   var dict = {};
-  dict[KEY_NEWS_ARTICLE] = article;
-  Pebble.sendAppMessage(dict, function () {
-    console.log('Article sent successfully');
-  }, function (e) {
-    console.log('Failed to send article: ' + JSON.stringify(e));
+  dict[KEY_NEWS_ARTICLE] = packed;
+  dict[KEY_ARTICLE_INDEX] = index;
+  dict[KEY_ARTICLE_SEQ] = seq;
+  dict[KEY_ARTICLE_DONE] = done ? 1 : 0;
+  // The watch asks for one chunk at a time, so a new request replaces any
+  // chunk still waiting
+  queueMessage({
+    label: 'article ' + index + ' chunk ' + seq,
+    dict: dict,
+    priority: urgent ? PRIORITY_ARTICLE : PRIORITY_PREFETCH,
+    coalesce: 'article',
+    sent: function (flightMs) {
+      delivered(flightMs);
+      if (done) {
+        logPacking('article ' + index);
+      }
+    }
   });
 }
 
+// Read a message value by numeric key or key name; unlike chaining with ||,
+// this keeps a value of 0 (the first feed or article)
+function payloadValue(payload, key, name) {
+  return payload[key] !== undefined ? payload[key] : payload[name];
+}
+
 // Pebble event handlers
 Pebble.addEventListener('ready', function (e) {
   console.log('PebbleKit JS ready');
   loadFeeds();
-  // Send feed names to the watch for the selection menu
-  sendFeedNames();
+  // Let the watch check its cached feed list for the selection menu
+  sendFeedListHash();
+  // Have the last used feed ready before it is picked again
+  prefetchLastFeed();
 });
 
 Pebble.addEventListener('appmessage', function (e) {
   console.log('Received message from Pebble: ' + JSON.stringify(e.payload));
 
+  var inboxSize = payloadValue(e.payload, KEY_INBOX_SIZE, 'KEY_INBOX_SIZE');
+  if (inboxSize !== undefined) {
+    g_inbox_size = parseInt(inboxSize) || DEFAULT_INBOX_SIZE;
+    console.log('Watch inbox size: ' + g_inbox_size);
+  }
+
   // Handle feed selection
-  var feedIndex = e.payload[KEY_SELECT_FEED] || e.payload['KEY_SELECT_FEED'] || e.payload['185'];
+  var feedIndex = payloadValue(e.payload, KEY_SELECT_FEED, 'KEY_SELECT_FEED');
   if (feedIndex !== undefined) {
     console.log('Feed selection received: ' + feedIndex);
     g_selected_feed_index = parseInt(feedIndex);
     g_items = [];
-    g_current_index = 0;
+    g_titles = null;
     fetchRssFeed();
     return;
   }
 
+  // Perf counters sent by the watch at the end of a session
+  var perfReport = payloadValue(e.payload, KEY_PERF_REPORT, 'KEY_PERF_REPORT');
+  if (perfReport !== undefined) {
+    console.log('Watch perf: ' + perfReport);
+    return;
+  }
+
   // Handle request for feed list
   var requestFeeds = e.payload[KEY_REQUEST_FEEDS] || e.payload['KEY_REQUEST_FEEDS'] || e.payload['184'];
   if (requestFeeds !== undefined) {
     console.log('Feed list request received');
-    sendFeedNames();
+    sendFeedList();
     return;
   }
 
   // Handle article request
-  var articleIndex = e.payload[KEY_REQUEST_ARTICLE] || e.payload['KEY_REQUEST_ARTICLE'] || e.payload['180'];
+  var articleIndex = payloadValue(e.payload, KEY_REQUEST_ARTICLE, 'KEY_REQUEST_ARTICLE');
   if (articleIndex !== undefined) {
-    console.log('Article request received for index: ' + articleIndex);
-    sendArticle(parseInt(articleIndex));
+    var articleSeq = payloadValue(e.payload, KEY_ARTICLE_SEQ, 'KEY_ARTICLE_SEQ') || 0;
+    var urgent = !!payloadValue(e.payload, KEY_ARTICLE_URGENT, 'KEY_ARTICLE_URGENT');
+    console.log('Article request received for index: ' + articleIndex + ', chunk ' + articleSeq);
+    sendArticleChunk(parseInt(articleIndex), parseInt(articleSeq), urgent);
     return;
   }
 
-  // Vérifier à la fois la clé numérique et le nom de clé
-  if (e.payload[KEY_REQUEST_NEWS] || e.payload['KEY_REQUEST_NEWS'] || e.payload['173']) {
-    console.log('News request received');
-    if (g_items.length === 0) {
-      fetchRssFeed();
-    } else {
-      sendNextNewsItem();
-    }
+  // Title stream acknowledgment
+  var newsAck = payloadValue(e.payload, KEY_NEWS_ACK, 'KEY_NEWS_ACK');
+  if (newsAck !== undefined) {
+    var newsWindow = payloadValue(e.payload, KEY_NEWS_WINDOW, 'KEY_NEWS_WINDOW') || 0;
+    console.log('Titles acked up to batch ' + newsAck + ', window ' + newsWindow);
+    titlesAcked(parseInt(newsAck), parseInt(newsWindow));
+    return;
   }
 
   if (e.payload[KEY_NEWS_FEED_URL] || e.payload['KEY_NEWS_FEED_URL'] || e.payload['175']) {
@@ -463,11 +1095,7 @@ Pebble.addEventListener('showConfiguration', function (e) {
   // Envoyer un signal à la montre pour afficher l'écran d'attente
   var dict = {};
   dict[KEY_CONFIG_OPENED] = 1;
-  Pebble.sendAppMessage(dict, function () {
-    console.log('Config opened signal sent');
-  }, function (err) {
-    console.log('Failed to send config opened signal: ' + JSON.stringify(err));
-  });
+  queueMessage({ label: 'config opened signal', dict: dict, priority: PRIORITY_CONFIG });
 
   Pebble.openURL(CONFIG_URL);
 });
@@ -493,7 +1121,7 @@ Pebble.addEventListener('webviewclosed', function (e) {
 
       // Reset items pour forcer le rechargement
       g_items = [];
-      g_current_index = 0;
+      g_titles = null;
     }
 
     // Gestion de la vitesse de lecture
@@ -510,6 +1138,13 @@ Pebble.addEventListener('webviewclosed', function (e) {
       localStorage.setItem('backlight_enabled', backlightEnabled);
     }
 
+    // Width of multi-word flashes in pixels, 0 for one word at a time
+    var chunkWidth = configData.chunk_width;
+    if (chunkWidth !== undefined) {
+      console.log('Saving chunk width: ' + chunkWidth);
+      localStorage.setItem('chunk_width', chunkWidth);
+    }
+
     // Envoyer toutes les données de config en une seule fois avec signal de réception
     var configDict = {};
     configDict[KEY_CONFIG_RECEIVED] = 1; // Signal de réception des paramètres (déclenche vibration + reset)
@@ -519,13 +1154,18 @@ Pebble.addEventListener('webviewclosed', function (e) {
     if (backlightEnabled !== undefined) {
       configDict[KEY_BACKLIGHT_ENABLED] = backlightEnabled ? 1 : 0;
     }
+    if (chunkWidth !== undefined) {
+      configDict[KEY_CHUNK_WIDTH] = parseInt(chunkWidth) || 0;
+    }
 
-    Pebble.sendAppMessage(configDict, function () {
-      console.log('Config received signal and speed sent');
-      // Send updated feed names to watch
-      sendFeedNames();
-    }, function (err) {
-      console.log('Failed to send config: ' + JSON.stringify(err));
+    queueMessage({
+      label: 'config',
+      dict: configDict,
+      priority: PRIORITY_CONFIG,
+      sent: function () {
+        // Let the watch fetch the feed list if it changed
+        sendFeedListHash();
+      }
     });
   } catch (err) {
     console.log('Error parsing configuration: ' + err.message);
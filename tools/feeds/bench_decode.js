@@ -0,0 +1,155 @@
+// Benchmark and regression check of the RSS text decoding in
+// src/pkjs/js/pebble-js-app.js, over the sample feeds next to this script.
+//
+// Usage: node tools/feeds/bench_decode.js [feed.xml...]
+//
+// Runs every title and description of the feeds through cleanText() (one
+// table-driven decode and tag-stripping pass) and through the chain of
+// replace() calls it replaced, and prints the time each takes and how often
+// their output differs. It also parses each feed with parseRssFeed() and
+// fails (exit status 1) if an item has no title or keeps markup or an
+// entity the decoder should have handled.
+//
+// The samples were written for this in the structure of the default BBC,
+// NYT and Le Monde feeds: CDATA sections, numeric references, named
+// entities and escaped HTML in descriptions.
+
+var fs = require('fs');
+var path = require('path');
+var vm = require('vm');
+
+var APP = path.join(__dirname, '..', '..', 'src', 'pkjs', 'js', 'pebble-js-app.js');
+var SAMPLES = path.join(__dirname, 'samples');
+var ROUNDS = 200;
+
+// Load the app with stand-ins for what PebbleKit JS provides
+function loadApp() {
+  var sandbox = {
+    Pebble: { addEventListener: function() {}, sendAppMessage: function() {} },
+    localStorage: { getItem: function() { return null; }, setItem: function() {}, removeItem: function() {} },
+    XMLHttpRequest: function() {},
+    console: { log: function() {} },
+    setTimeout: setTimeout,
+    clearTimeout: clearTimeout,
+    unescape: unescape,
+    encodeURIComponent: encodeURIComponent
+  };
+  vm.createContext(sandbox);
+  vm.runInContext(fs.readFileSync(APP, 'utf8'), sandbox, { filename: APP });
+  return sandbox;
+}
+
+// The decoder this replaced: one global replace() per entity, then a
+// separate pass to strip tags
+var LEGACY_ENTITIES = [
+  ['&amp;', '&'], ['&lt;', '<'], ['&gt;', '>'], ['&quot;', '"'], ['&#39;', "'"],
+  ['&apos;', "'"], ['&nbsp;', ' '], ['&#8217;', "'"], ['&#8220;', '"'], ['&#8221;', '"'],
+  ['&#8211;', '-'], ['&#8212;', '-'], ['&#160;', ' '], ['&rsquo;', "'"], ['&lsquo;', "'"],
+  ['&rdquo;', '"'], ['&ldquo;', '"'], ['&mdash;', '-'], ['&ndash;', '-'],
+  ['&eacute;', 'é'], ['&#233;', 'é'], ['&egrave;', 'è'], ['&#232;', 'è'], ['&ecirc;', 'ê'],
+  ['&#234;', 'ê'], ['&euml;', 'ë'], ['&#235;', 'ë'], ['&agrave;', 'à'], ['&#224;', 'à'],
+  ['&acirc;', 'â'], ['&#226;', 'â'], ['&auml;', 'ä'], ['&#228;', 'ä'], ['&ugrave;', 'ù'],
+  ['&#249;', 'ù'], ['&ucirc;', 'û'], ['&#251;', 'û'], ['&uuml;', 'ü'], ['&#252;', 'ü'],
+  ['&ocirc;', 'ô'], ['&#244;', 'ô'], ['&ouml;', 'ö'], ['&#246;', 'ö'], ['&icirc;', 'î'],
+  ['&#238;', 'î'], ['&iuml;', 'ï'], ['&#239;', 'ï'], ['&ccedil;', 'ç'], ['&#231;', 'ç'],
+  ['&aelig;', 'æ'], ['&#230;', 'æ'], ['&oelig;', 'œ'], ['&#339;', 'œ'],
+  ['&Eacute;', 'É'], ['&#201;', 'É'], ['&Egrave;', 'È'], ['&#200;', 'È'], ['&Ecirc;', 'Ê'],
+  ['&#202;', 'Ê'], ['&Agrave;', 'À'], ['&#192;', 'À'], ['&Acirc;', 'Â'], ['&#194;', 'Â'],
+  ['&Ccedil;', 'Ç'], ['&#199;', 'Ç']
+].map(function(entry) {
+  return [new RegExp(entry[0], 'g'), entry[1]];
+});
+
+function legacyCleanText(text) {
+  var decoded = text || '';
+  for (var i = 0; i < LEGACY_ENTITIES.length; i++) {
+    decoded = decoded.replace(LEGACY_ENTITIES[i][0], LEGACY_ENTITIES[i][1]);
+  }
+  return decoded.replace(/<[^>]*>/g, '').trim();
+}
+
+// Raw text of every title and description, as the parser hands it to
+// cleanText(): CDATA unwrapped, markup inside kept
+function rawFields(xml) {
+  var fields = [];
+  var pattern = /<(title|description)>([\s\S]*?)<\/\1>/g;
+  var match;
+  while ((match = pattern.exec(xml)) !== null) {
+    fields.push(match[2].replace(/<!\[CDATA\[([\s\S]*?)\]\]>/g, '$1'));
+  }
+  return fields;
+}
+
+function timeMs(fields, clean) {
+  for (var warm = 0; warm < 20; warm++) {
+    fields.forEach(clean);
+  }
+  var start = process.hrtime();
+  for (var round = 0; round < ROUNDS; round++) {
+    for (var i = 0; i < fields.length; i++) {
+      clean(fields[i]);
+    }
+  }
+  var elapsed = process.hrtime(start);
+  return (elapsed[0] * 1e3 + elapsed[1] / 1e6) / ROUNDS;
+}
+
+var LEFTOVER_MARKUP = /<\/?[a-zA-Z!][^>]*>/;
+var LEFTOVER_ENTITY = /&(#[0-9]+|#[xX][0-9a-fA-F]+|[a-zA-Z][a-zA-Z0-9]*);/;
+
+function checkFeed(app, file, xml) {
+  var errors = [];
+  var feed = app.parseRssFeed(xml);
+  if (feed.items.length === 0) {
+    errors.push('no items');
+  }
+  feed.items.forEach(function(item, i) {
+    [['title', item.title], ['description', item.description]].forEach(function(field) {
+      if (LEFTOVER_MARKUP.test(field[1]) || LEFTOVER_ENTITY.test(field[1])) {
+        errors.push('item ' + i + ' ' + field[0] + ': ' + JSON.stringify(field[1]));
+      }
+    });
+  });
+  errors.forEach(function(error) {
+    console.log('  FAIL ' + path.basename(file) + ': ' + error);
+  });
+  return { items: feed.items.length, errors: errors.length };
+}
+
+var app = loadApp();
+var files = process.argv.slice(2);
+if (files.length === 0) {
+  files = fs.readdirSync(SAMPLES).filter(function(name) {
+    return /\.xml$/.test(name);
+  }).sort().map(function(name) {
+    return path.join(SAMPLES, name);
+  });
+}
+
+var failed = false;
+var allFields = [];
+files.forEach(function(file) {
+  var xml = fs.readFileSync(file, 'utf8');
+  var fields = rawFields(xml);
+  var differ = fields.filter(function(text) {
+    return legacyCleanText(text) !== app.cleanText(text);
+  }).length;
+  var check = checkFeed(app, file, xml);
+  var parseMs = timeMs([xml], app.parseRssFeed);
+  var legacyMs = timeMs(fields, legacyCleanText);
+  var newMs = timeMs(fields, app.cleanText);
+  console.log(path.basename(file) + ': ' + check.items + ' items, ' + fields.length +
+              ' fields, parse ' + parseMs.toFixed(3) + ' ms');
+  console.log('  decode: ' + newMs.toFixed(3) + ' ms, before ' + legacyMs.toFixed(3) +
+              ' ms (' + (legacyMs / newMs).toFixed(1) + 'x); output differs for ' +
+              differ + ' fields');
+  failed = failed || check.errors > 0;
+  allFields = allFields.concat(fields);
+});
+
+var totalLegacy = timeMs(allFields, legacyCleanText);
+var totalNew = timeMs(allFields, app.cleanText);
+console.log('All feeds: ' + allFields.length + ' fields, decode ' + totalNew.toFixed(3) +
+            ' ms, before ' + totalLegacy.toFixed(3) + ' ms (' +
+            (totalLegacy / totalNew).toFixed(1) + 'x)');
+process.exit(failed ? 1 : 0);
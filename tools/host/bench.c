@@ -0,0 +1,399 @@
+// Host benchmark of the watch's word pipeline, run through src/c/rsvp_news.c
+// on the SDK stand-in in this directory.
+//
+// Build and run from the repository root:
+//   cc -O2 -std=gnu99 -Itools/host -Isrc/c -o host_bench tools/host/bench.c
+//       tools/host/pebble_host.c src/c/rsvp_text.c
+//   ./host_bench [-g chunk width] [corpus directory]
+//
+// The corpus (tools/host/corpus by default) holds headlines.txt, one title
+// per line, and articles as *_article.txt. For each it prints the host time
+// per word and the heap calls of three stages:
+//   tokenize   titles: index_words(); articles: chunks delivered through
+//              inbox_received_callback() and tokenized in the ring
+//   pacing     word delay, pacing model update and pivot
+//   word step  what the word timer runs per flash, rsvp_timer_callback():
+//              extraction, pacing and scheduling the next word
+// It then extracts every word of the first article cut or repeated to
+// lengths from 125 to 4000 bytes, with the word index the reader uses and
+// with the rescan from byte 0 that it replaced, to show the cost per word
+// staying flat as articles grow.
+// Timings are host nanoseconds, for comparing changes, not watch figures.
+// Heap calls are counted in code that includes pebble.h; rsvp_text.c only
+// uses string.h.
+
+#define main watch_main
+#include "rsvp_news.c"
+#undef main
+
+#include <dirent.h>
+
+#include "pebble_host.h"
+
+#define BENCH_MAX_TITLES 256
+#define BENCH_MAX_TEXT 65536
+#define BENCH_TITLE_ROUNDS 2000
+#define BENCH_ARTICLE_ROUNDS 500
+#define BENCH_SCALING_ROUNDS 200
+
+typedef struct {
+  double ns;
+  unsigned long words;
+  unsigned long heap_calls;
+} BenchStage;
+
+static double bench_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void stage_start(BenchStage *stage) {
+  stage->words = 0;
+  stage->heap_calls = host_heap_calls();
+  stage->ns = bench_now_ns();
+}
+
+static void stage_end(BenchStage *stage) {
+  stage->ns = bench_now_ns() - stage->ns;
+  stage->heap_calls = host_heap_calls() - stage->heap_calls;
+}
+
+static void stage_print(const char *name, const BenchStage *stage) {
+  printf("  %-10s %7.1f ns/word  %lu heap calls\n", name,
+         stage->words ? stage->ns / stage->words : 0.0, stage->heap_calls);
+}
+
+static char *bench_read_file(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return NULL;
+  }
+  char *text = calloc(BENCH_MAX_TEXT + 1, 1);
+  size_t length = fread(text, 1, BENCH_MAX_TEXT, file);
+  text[length] = '\0';
+  fclose(file);
+  return text;
+}
+
+// Pacing alone: the delay and model update of every word, as the word timer
+// runs them, and the pivot the word is drawn around
+static void bench_pacing(const char *text, int rounds, BenchStage *stage) {
+  static char copy[BENCH_MAX_TEXT + 1];
+  static char *words[BENCH_MAX_TEXT / 2];
+  strcpy(copy, text);
+  int count = 0;
+  for (char *word = strtok(copy, " \t\r\n"); word;
+       word = strtok(NULL, " \t\r\n")) {
+    words[count++] = word;
+  }
+
+  volatile uint32_t sink = 0;
+  stage_start(stage);
+  for (int round = 0; round < rounds; round++) {
+    pacing_reset(&s_pacing_model);
+    for (int i = 0; i < count; i++) {
+      sink += calculate_word_delay(&s_pacing_model, words[i], rsvp_wpm_ms);
+      pacing_add_word(&s_pacing_model, words[i], rsvp_wpm_ms);
+      sink += get_text_pivot_index(words[i], strlen(words[i]));
+    }
+    stage->words += count;
+  }
+  stage_end(stage);
+}
+
+static void bench_titles(const char *path) {
+  char *text = bench_read_file(path);
+  if (!text) {
+    return;
+  }
+  static const char *titles[BENCH_MAX_TITLES];
+  int count = 0;
+  for (char *line = strtok(text, "\n"); line && count < BENCH_MAX_TITLES;
+       line = strtok(NULL, "\n")) {
+    titles[count++] = line;
+  }
+
+  BenchStage tokenize, step;
+  stage_start(&tokenize);
+  for (int round = 0; round < BENCH_TITLE_ROUNDS; round++) {
+    for (int i = 0; i < count; i++) {
+      index_words(&s_title_words, titles[i]);
+      tokenize.words += s_title_words.count;
+    }
+  }
+  stage_end(&tokenize);
+
+  // Each title as the reader shows it, one timer step per flash
+  s_first_news_after_splash = false;
+  stage_start(&step);
+  for (int round = 0; round < BENCH_TITLE_ROUNDS; round++) {
+    for (int i = 0; i < count; i++) {
+      snprintf(news_title, sizeof(news_title), "%s", titles[i]);
+      start_rsvp_for_title();
+      while (rsvp_word[0] != '\0') {
+        rsvp_timer_callback(NULL);
+      }
+      step.words += s_title_words.count;
+    }
+  }
+  stage_end(&step);
+
+  // Pacing over the titles as one text
+  BenchStage pacing;
+  char *joined = calloc(BENCH_MAX_TEXT + 1, 1);
+  for (int i = 0; i < count; i++) {
+    strcat(joined, titles[i]);
+    strcat(joined, " ");
+  }
+  bench_pacing(joined, BENCH_TITLE_ROUNDS, &pacing);
+
+  printf("%s: %d titles, %lu words each round\n", path, count,
+         tokenize.words / BENCH_TITLE_ROUNDS);
+  stage_print("tokenize", &tokenize);
+  stage_print("pacing", &pacing);
+  stage_print("word step", &step);
+  free(joined);
+  free(text);
+}
+
+// Answer the app's outbox message: an article chunk request gets the chunk
+// it asked for. False if nothing was in flight.
+static bool bench_answer_outbox(const char *article) {
+  DictionaryIterator *out = host_outbox_in_flight();
+  if (!out) {
+    return false;
+  }
+  Tuple *request = dict_find(out, KEY_REQUEST_ARTICLE);
+  Tuple *seq_tuple = dict_find(out, KEY_ARTICLE_SEQ);
+  uint8_t index = request ? request->value->uint8 : 0;
+  uint16_t seq = seq_tuple ? seq_tuple->value->uint16 : 0;
+  host_outbox_result(true, APP_MSG_OK);
+  if (!request) {
+    return true;
+  }
+
+  // Plain UTF-8 text is its own packed form
+  size_t length = strlen(article);
+  size_t start = (size_t)seq * s_article_chunk_max;
+  size_t size = length - start < s_article_chunk_max ? length - start
+                                                     : s_article_chunk_max;
+  uint8_t done = start + size >= length;
+  DictionaryIterator *in = host_inbox_begin();
+  dict_write_data(in, KEY_NEWS_ARTICLE, (const uint8_t *)&article[start],
+                  size);
+  dict_write_uint8(in, KEY_ARTICLE_INDEX, index);
+  dict_write_uint16(in, KEY_ARTICLE_SEQ, seq);
+  dict_write_uint8(in, KEY_ARTICLE_DONE, done);
+  host_inbox_deliver();
+  return true;
+}
+
+// Start streaming article 0 with the user waiting for it
+static void bench_request_article(void) {
+  reset_article_stream();
+  s_reading_article = false;
+  rsvp_word_index = 0;
+  current_news_index = 0;
+  s_article_news_index = 0;
+  prefetch_article(0);
+}
+
+static void bench_article(const char *path) {
+  char *article = bench_read_file(path);
+  if (!article) {
+    return;
+  }
+
+  // Tokenizing alone: chunks go into the ring and the reader jumps to the
+  // last word tokenized, so the ring frees up for the next chunk
+  BenchStage tokenize;
+  stage_start(&tokenize);
+  for (int round = 0; round < BENCH_ARTICLE_ROUNDS; round++) {
+    bench_request_article();
+    s_reading_article = true;
+    while (bench_answer_outbox(article)) {
+      do {
+        tokenize_article();
+        rsvp_word_index = s_article_word_count;
+      } while (s_article_scan != s_article_head);
+      request_next_article_chunk();
+    }
+    tokenize.words += s_article_word_count;
+  }
+  stage_end(&tokenize);
+
+  // Reading: chunks arrive as the reader asks for them, one timer step per
+  // flash until the article ends
+  BenchStage step;
+  stage_start(&step);
+  for (int round = 0; round < BENCH_ARTICLE_ROUNDS; round++) {
+    bench_request_article();
+    uint16_t words = 0; // The article's word count, before it ends
+    while (bench_answer_outbox(article) || s_reading_article) {
+      if (s_reading_article && !host_outbox_in_flight()) {
+        words = s_article_word_count;
+        rsvp_timer_callback(NULL);
+      }
+    }
+    step.words += words;
+  }
+  stage_end(&step);
+
+  BenchStage pacing;
+  bench_pacing(article, BENCH_ARTICLE_ROUNDS, &pacing);
+
+  printf("%s: %lu words\n", path, tokenize.words / BENCH_ARTICLE_ROUNDS);
+  stage_print("tokenize", &tokenize);
+  stage_print("pacing", &pacing);
+  stage_print("word step", &step);
+  free(article);
+}
+
+// The extraction this replaced: scan the text from byte 0 for word index on
+// every tick (without its 1000-byte safety limit)
+static bool legacy_extract(const char *p, uint16_t index, char *buffer,
+                           size_t size) {
+  uint16_t word_count = 0;
+  uint16_t word_start = 0;
+  uint16_t word_len = 0;
+  bool in_word = false;
+  uint16_t i = 0;
+  for (; p[i] != '\0'; i++) {
+    if (p[i] == ' ' || p[i] == '\t' || p[i] == '\n') {
+      if (in_word) {
+        if (word_count == index) {
+          break;
+        }
+        word_count++;
+        in_word = false;
+      }
+    } else {
+      if (!in_word) {
+        word_start = i;
+        word_len = 0;
+        in_word = true;
+      }
+      word_len++;
+    }
+  }
+  if (!in_word || word_count != index) {
+    return false;
+  }
+  if (word_len > size - 1) {
+    word_len = size - 1;
+  }
+  memcpy(buffer, &p[word_start], word_len);
+  buffer[word_len] = '\0';
+  return true;
+}
+
+// Extraction cost per word by article length: the rescan against the word
+// index, which is built as chunks arrive and read with copy_word()
+static void bench_scaling(const char *path) {
+  char *source = bench_read_file(path);
+  if (!source) {
+    return;
+  }
+  static const uint16_t LENGTHS[] = {125, 250, 500, 1000, 2000, 4000};
+  char *text = calloc(BENCH_MAX_TEXT + 1, 1);
+  char word[sizeof(rsvp_word)];
+  volatile uint32_t sink = 0;
+
+  printf("%s cut or repeated, extraction only:\n", path);
+  printf("  %5s %5s %14s %15s\n", "bytes", "words", "rescan ns/word",
+         "indexed ns/word");
+  for (size_t l = 0; l < ARRAY_LENGTH(LENGTHS); l++) {
+    // Fill to the length with whole words
+    size_t length = 0;
+    while (length < LENGTHS[l]) {
+      for (const char *c = source; *c && length < LENGTHS[l]; c++) {
+        text[length++] = *c == '\n' ? ' ' : *c;
+      }
+      text[length++] = ' ';
+    }
+    while (length > 0 && text[length - 1] != ' ') {
+      length--;
+    }
+    text[length > 0 ? --length : 0] = '\0';
+
+    BenchStage rescan;
+    stage_start(&rescan);
+    for (int round = 0; round < BENCH_SCALING_ROUNDS; round++) {
+      for (uint16_t i = 0; legacy_extract(text, i, word, sizeof(word)); i++) {
+        sink += word[0];
+        rescan.words++;
+      }
+    }
+    stage_end(&rescan);
+
+    BenchStage indexed;
+    stage_start(&indexed);
+    for (int round = 0; round < BENCH_SCALING_ROUNDS; round++) {
+      bench_request_article();
+      s_reading_article = true;
+      while (bench_answer_outbox(text)) {
+        do {
+          tokenize_article();
+          for (; rsvp_word_index < s_article_word_count; rsvp_word_index++) {
+            copy_word(rsvp_word_index, word, sizeof(word));
+            sink += word[0];
+          }
+        } while (s_article_scan != s_article_head);
+        request_next_article_chunk();
+      }
+      indexed.words += s_article_word_count;
+    }
+    stage_end(&indexed);
+
+    printf("  %5zu %5lu %14.1f %15.1f\n", length,
+           rescan.words / BENCH_SCALING_ROUNDS, rescan.ns / rescan.words,
+           indexed.ns / indexed.words);
+  }
+  s_reading_article = false;
+  free(text);
+  free(source);
+}
+
+int main(int argc, char **argv) {
+  const char *corpus = "tools/host/corpus";
+  int chunk_width = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      chunk_width = atoi(argv[++i]);
+    } else {
+      corpus = argv[i];
+    }
+  }
+
+  init();
+  set_chunk_width(chunk_width);
+  printf("%d WPM, chunk width %d px\n", 60000 / rsvp_wpm_ms, s_chunk_width);
+
+  char path[512];
+  snprintf(path, sizeof(path), "%s/headlines.txt", corpus);
+  bench_titles(path);
+
+  struct dirent **entries;
+  int count = scandir(corpus, &entries, NULL, alphasort);
+  if (count < 0) {
+    fprintf(stderr, "Can't open %s\n", corpus);
+    return 1;
+  }
+  char first_article[512] = "";
+  for (int i = 0; i < count; i++) {
+    const char *suffix = strstr(entries[i]->d_name, "_article.txt");
+    if (suffix && strcmp(suffix, "_article.txt") == 0) {
+      snprintf(path, sizeof(path), "%s/%s", corpus, entries[i]->d_name);
+      bench_article(path);
+      if (first_article[0] == '\0') {
+        snprintf(first_article, sizeof(first_article), "%s", path);
+      }
+    }
+  }
+  if (first_article[0] != '\0') {
+    bench_scaling(first_article);
+  }
+  deinit();
+  return 0;
+}
@@ -0,0 +1,280 @@
+#pragma once
+
+// Host stand-in for the parts of the Pebble SDK that src/c/rsvp_news.c uses,
+// so the watch code builds and runs on Linux. Declarations follow the SDK's
+// names and signatures; pebble_host.c implements them: timers on a virtual
+// clock, messages, persistent storage, clicks and text measurement, with
+// drawing left out. pebble_host.h drives them from a host program.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Logging: app logs are dropped, except with HOST_LOG set in the environment
+enum {
+  APP_LOG_LEVEL_ERROR = 1,
+  APP_LOG_LEVEL_WARNING = 50,
+  APP_LOG_LEVEL_INFO = 100,
+  APP_LOG_LEVEL_DEBUG = 200,
+};
+void host_app_log(uint8_t level, const char *fmt, ...);
+#define APP_LOG(level, fmt, ...) host_app_log(level, fmt, ##__VA_ARGS__)
+
+#define ARRAY_LENGTH(array) (sizeof(array) / sizeof((array)[0]))
+
+// Heap calls are counted for the benchmarks (see host_heap_calls())
+void *host_malloc(size_t size);
+void *host_calloc(size_t count, size_t size);
+void *host_realloc(void *ptr, size_t size);
+void host_free(void *ptr);
+#define malloc(size) host_malloc(size)
+#define calloc(count, size) host_calloc(count, size)
+#define realloc(ptr, size) host_realloc(ptr, size)
+#define free(ptr) host_free(ptr)
+
+// Graphics
+typedef struct GContext GContext;
+typedef struct GBitmap GBitmap;
+typedef const char *GFont;
+typedef struct {
+  int16_t x;
+  int16_t y;
+} GPoint;
+typedef struct {
+  int16_t w;
+  int16_t h;
+} GSize;
+typedef struct {
+  GPoint origin;
+  GSize size;
+} GRect;
+#define GPoint(x, y) ((GPoint){(x), (y)})
+#define GSize(w, h) ((GSize){(w), (h)})
+#define GRect(x, y, w, h) ((GRect){{(x), (y)}, {(w), (h)}})
+#define GRectZero GRect(0, 0, 0, 0)
+
+typedef uint8_t GColor;
+enum { GColorBlack, GColorWhite, GColorRed, GColorClear };
+typedef enum { GCornerNone } GCornerMask;
+typedef enum {
+  GTextOverflowModeWordWrap,
+  GTextOverflowModeTrailingEllipsis,
+} GTextOverflowMode;
+typedef enum {
+  GTextAlignmentLeft,
+  GTextAlignmentCenter,
+  GTextAlignmentRight,
+} GTextAlignment;
+typedef void GTextAttributes;
+
+#define FONT_KEY_GOTHIC_14 "GOTHIC_14"
+#define FONT_KEY_GOTHIC_18 "GOTHIC_18"
+#define FONT_KEY_GOTHIC_18_BOLD "GOTHIC_18_BOLD"
+#define FONT_KEY_GOTHIC_24_BOLD "GOTHIC_24_BOLD"
+#define FONT_KEY_GOTHIC_28 "GOTHIC_28"
+#define FONT_KEY_BITHAM_42_BOLD "BITHAM_42_BOLD"
+
+GFont fonts_get_system_font(const char *font_key);
+void graphics_context_set_fill_color(GContext *ctx, GColor color);
+void graphics_context_set_stroke_color(GContext *ctx, GColor color);
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius,
+                        GCornerMask corner_mask);
+void graphics_draw_line(GContext *ctx, GPoint p0, GPoint p1);
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius);
+void graphics_draw_text(GContext *ctx, const char *text, GFont font,
+                        GRect box, GTextOverflowMode overflow_mode,
+                        GTextAlignment alignment,
+                        GTextAttributes *text_attributes);
+GSize graphics_text_layout_get_content_size(const char *text, GFont font,
+                                            GRect box,
+                                            GTextOverflowMode overflow_mode,
+                                            GTextAlignment alignment);
+
+// Layers and windows
+typedef struct Layer Layer;
+typedef struct Window Window;
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+Layer *layer_create(GRect frame);
+void layer_destroy(Layer *layer);
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+void layer_add_child(Layer *parent, Layer *child);
+void layer_set_hidden(Layer *layer, bool hidden);
+void layer_mark_dirty(Layer *layer);
+GRect layer_get_bounds(const Layer *layer);
+
+typedef void (*WindowHandler)(Window *window);
+typedef struct {
+  WindowHandler load;
+  WindowHandler appear;
+  WindowHandler disappear;
+  WindowHandler unload;
+} WindowHandlers;
+Window *window_create(void);
+void window_destroy(Window *window);
+void window_set_window_handlers(Window *window, WindowHandlers handlers);
+void window_set_background_color(Window *window, GColor background_color);
+Layer *window_get_root_layer(const Window *window);
+void window_stack_push(Window *window, bool animated);
+Window *window_stack_pop(bool animated);
+
+// Clicks
+typedef enum {
+  BUTTON_ID_BACK,
+  BUTTON_ID_UP,
+  BUTTON_ID_SELECT,
+  BUTTON_ID_DOWN,
+  NUM_BUTTONS,
+} ButtonId;
+typedef void *ClickRecognizerRef;
+typedef void (*ClickHandler)(ClickRecognizerRef recognizer, void *context);
+typedef void (*ClickConfigProvider)(void *context);
+void window_set_click_config_provider(Window *window,
+                                      ClickConfigProvider click_config_provider);
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler);
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms,
+                                 ClickHandler down_handler,
+                                 ClickHandler up_handler);
+ButtonId click_recognizer_get_button_id(ClickRecognizerRef recognizer);
+
+// Menu layer
+typedef struct MenuLayer MenuLayer;
+typedef struct {
+  uint16_t section;
+  uint16_t row;
+} MenuIndex;
+typedef enum { MenuRowAlignNone, MenuRowAlignCenter } MenuRowAlign;
+typedef uint16_t (*MenuLayerGetNumberOfRowsInSectionsCallback)(
+    MenuLayer *menu_layer, uint16_t section_index, void *callback_context);
+typedef void (*MenuLayerDrawRowCallback)(GContext *ctx,
+                                         const Layer *cell_layer,
+                                         MenuIndex *cell_index,
+                                         void *callback_context);
+typedef void (*MenuLayerSelectCallback)(MenuLayer *menu_layer,
+                                        MenuIndex *cell_index,
+                                        void *callback_context);
+typedef struct {
+  MenuLayerGetNumberOfRowsInSectionsCallback get_num_rows;
+  MenuLayerDrawRowCallback draw_row;
+  MenuLayerSelectCallback select_click;
+} MenuLayerCallbacks;
+MenuLayer *menu_layer_create(GRect frame);
+void menu_layer_destroy(MenuLayer *menu_layer);
+void menu_layer_set_callbacks(MenuLayer *menu_layer, void *callback_context,
+                              MenuLayerCallbacks callbacks);
+Layer *menu_layer_get_layer(const MenuLayer *menu_layer);
+void menu_layer_reload_data(MenuLayer *menu_layer);
+void menu_layer_set_selected_next(MenuLayer *menu_layer, bool up,
+                                  MenuRowAlign scroll_align, bool animated);
+MenuIndex menu_layer_get_selected_index(const MenuLayer *menu_layer);
+void menu_cell_basic_draw(GContext *ctx, const Layer *cell_layer,
+                          const char *title, const char *subtitle,
+                          GBitmap *icon);
+
+// Timers and time
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback,
+                             void *callback_data);
+bool app_timer_reschedule(AppTimer *timer, uint32_t new_timeout_ms);
+void app_timer_cancel(AppTimer *timer);
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms);
+
+// Dictionaries and AppMessage
+typedef enum {
+  TUPLE_BYTE_ARRAY = 0,
+  TUPLE_CSTRING = 1,
+  TUPLE_UINT = 2,
+  TUPLE_INT = 3,
+} TupleType;
+typedef struct __attribute__((__packed__)) {
+  uint32_t key;
+  TupleType type : 8;
+  uint16_t length;
+  union {
+    uint8_t data[0];
+    char cstring[0];
+    uint8_t uint8;
+    uint16_t uint16;
+    uint32_t uint32;
+    int8_t int8;
+    int16_t int16;
+    int32_t int32;
+  } value[];
+} Tuple;
+typedef struct DictionaryIterator DictionaryIterator;
+typedef enum { DICT_OK = 0, DICT_NOT_ENOUGH_STORAGE = 2 } DictionaryResult;
+Tuple *dict_find(const DictionaryIterator *iter, uint32_t key);
+Tuple *dict_read_first(DictionaryIterator *iter);
+Tuple *dict_read_next(DictionaryIterator *iter);
+DictionaryResult dict_write_uint8(DictionaryIterator *iter, uint32_t key,
+                                  uint8_t value);
+DictionaryResult dict_write_uint16(DictionaryIterator *iter, uint32_t key,
+                                   uint16_t value);
+DictionaryResult dict_write_uint32(DictionaryIterator *iter, uint32_t key,
+                                   uint32_t value);
+DictionaryResult dict_write_cstring(DictionaryIterator *iter, uint32_t key,
+                                    const char *cstring);
+DictionaryResult dict_write_data(DictionaryIterator *iter, uint32_t key,
+                                 const uint8_t *data, const uint16_t size);
+
+typedef enum {
+  APP_MSG_OK = 0,
+  APP_MSG_SEND_TIMEOUT = 1 << 1,
+  APP_MSG_BUSY = 1 << 6,
+} AppMessageResult;
+typedef void (*AppMessageInboxReceived)(DictionaryIterator *iterator,
+                                        void *context);
+typedef void (*AppMessageInboxDropped)(AppMessageResult reason, void *context);
+typedef void (*AppMessageOutboxSent)(DictionaryIterator *iterator,
+                                     void *context);
+typedef void (*AppMessageOutboxFailed)(DictionaryIterator *iterator,
+                                       AppMessageResult reason, void *context);
+AppMessageResult app_message_open(const uint32_t size_inbound,
+                                  const uint32_t size_outbound);
+uint32_t app_message_inbox_size_maximum(void);
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator);
+AppMessageResult app_message_outbox_send(void);
+void app_message_register_inbox_received(AppMessageInboxReceived callback);
+void app_message_register_inbox_dropped(AppMessageInboxDropped callback);
+void app_message_register_outbox_sent(AppMessageOutboxSent callback);
+void app_message_register_outbox_failed(AppMessageOutboxFailed callback);
+void app_message_deregister_callbacks(void);
+
+// Persistent storage
+#define PERSIST_DATA_MAX_LENGTH 256
+bool persist_exists(const uint32_t key);
+int persist_get_size(const uint32_t key);
+int32_t persist_read_int(const uint32_t key);
+bool persist_read_bool(const uint32_t key);
+int persist_read_data(const uint32_t key, void *buffer,
+                      const size_t buffer_size);
+int persist_read_string(const uint32_t key, char *buffer,
+                        const size_t buffer_size);
+int persist_write_int(const uint32_t key, const int32_t value);
+int persist_write_bool(const uint32_t key, const bool value);
+int persist_write_data(const uint32_t key, const void *data,
+                       const size_t size);
+int persist_write_string(const uint32_t key, const char *cstring);
+int persist_delete(const uint32_t key);
+
+// System services
+typedef struct {
+  const uint32_t *durations;
+  uint32_t num_segments;
+} VibePattern;
+void vibes_enqueue_custom_pattern(VibePattern pattern);
+void light_enable_interaction(void);
+size_t heap_bytes_free(void);
+typedef void (*AppFocusHandler)(bool in_focus);
+typedef struct {
+  AppFocusHandler will_focus;
+  AppFocusHandler did_focus;
+} AppFocusHandlers;
+void app_focus_service_subscribe_handlers(AppFocusHandlers handlers);
+void app_focus_service_unsubscribe(void);
+void app_event_loop(void);
@@ -0,0 +1,577 @@
+// Host implementation of the Pebble SDK stand-in declared in pebble.h. See
+// pebble_host.h for how a host program drives it.
+
+#include "pebble_host.h"
+
+#include <stdarg.h>
+
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+#define MAX_TIMERS 16
+#define MAX_PERSIST_KEYS 64
+#define MAX_TUPLES 16
+#define DICT_BUFFER_SIZE 4096
+#define CHAR_WIDTH 12 // Advance of every character, in pixels
+#define TEXT_HEIGHT 28
+
+static uint32_t s_clock_ms = HOST_EPOCH_MS;
+static unsigned long s_heap_calls = 0;
+void (*host_log_hook)(const char *line) = NULL;
+
+void host_app_log(uint8_t level, const char *fmt, ...) {
+  char line[512];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  if (host_log_hook) {
+    host_log_hook(line);
+  }
+  if (getenv("HOST_LOG")) {
+    printf("%9.3f  %s\n", (s_clock_ms - HOST_EPOCH_MS) / 1000.0, line);
+  }
+}
+
+void *host_malloc(size_t size) {
+  s_heap_calls++;
+  return malloc(size);
+}
+
+void *host_calloc(size_t count, size_t size) {
+  s_heap_calls++;
+  return calloc(count, size);
+}
+
+void *host_realloc(void *ptr, size_t size) {
+  s_heap_calls++;
+  return realloc(ptr, size);
+}
+
+void host_free(void *ptr) { free(ptr); }
+
+unsigned long host_heap_calls(void) { return s_heap_calls; }
+
+uint32_t host_clock_ms(void) { return s_clock_ms; }
+
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms) {
+  if (tloc) {
+    *tloc = s_clock_ms / 1000;
+  }
+  if (out_ms) {
+    *out_ms = s_clock_ms % 1000;
+  }
+  return s_clock_ms % 1000;
+}
+
+struct AppTimer {
+  uint32_t due_ms;
+  uint32_t order; // Registration order, to break ties
+  AppTimerCallback callback;
+  void *data;
+  bool live;
+};
+static struct AppTimer s_timers[MAX_TIMERS];
+static uint32_t s_timer_order = 0;
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback,
+                             void *callback_data) {
+  for (int i = 0; i < MAX_TIMERS; i++) {
+    if (!s_timers[i].live) {
+      s_timers[i] = (struct AppTimer){s_clock_ms + timeout_ms, s_timer_order++,
+                                      callback, callback_data, true};
+      return &s_timers[i];
+    }
+  }
+  fprintf(stderr, "Out of host timers\n");
+  abort();
+}
+
+bool app_timer_reschedule(AppTimer *timer, uint32_t new_timeout_ms) {
+  if (!timer || !timer->live) {
+    return false;
+  }
+  timer->due_ms = s_clock_ms + new_timeout_ms;
+  return true;
+}
+
+void app_timer_cancel(AppTimer *timer) {
+  if (timer) {
+    timer->live = false;
+  }
+}
+
+// Earliest live timer due by time_ms, or NULL
+static struct AppTimer *next_timer(uint32_t time_ms) {
+  struct AppTimer *next = NULL;
+  for (int i = 0; i < MAX_TIMERS; i++) {
+    struct AppTimer *timer = &s_timers[i];
+    if (timer->live && (int32_t)(timer->due_ms - time_ms) <= 0 &&
+        (!next || (int32_t)(timer->due_ms - next->due_ms) < 0 ||
+         (timer->due_ms == next->due_ms && timer->order < next->order))) {
+      next = timer;
+    }
+  }
+  return next;
+}
+
+void host_run_until(uint32_t time_ms, void (*after_timer)(void)) {
+  struct AppTimer *timer;
+  while (!host_exited() && (timer = next_timer(time_ms))) {
+    s_clock_ms = timer->due_ms;
+    timer->live = false;
+    timer->callback(timer->data);
+    if (after_timer) {
+      after_timer();
+    }
+  }
+  if ((int32_t)(time_ms - s_clock_ms) > 0) {
+    s_clock_ms = time_ms;
+  }
+}
+
+struct DictionaryIterator {
+  uint8_t buffer[DICT_BUFFER_SIZE];
+  uint16_t used;
+  uint16_t offsets[MAX_TUPLES];
+  uint8_t count;
+  uint8_t cursor;
+};
+static DictionaryIterator s_inbox;
+static DictionaryIterator s_outbox;
+static bool s_outbox_busy = false;
+
+static void dict_reset(DictionaryIterator *iter) {
+  iter->used = 0;
+  iter->count = 0;
+  iter->cursor = 0;
+}
+
+DictionaryResult host_dict_write(DictionaryIterator *iter, uint32_t key,
+                                 TupleType type, const void *data,
+                                 uint16_t length) {
+  if (iter->count == MAX_TUPLES ||
+      iter->used + sizeof(Tuple) + length > DICT_BUFFER_SIZE) {
+    return DICT_NOT_ENOUGH_STORAGE;
+  }
+  Tuple *tuple = (Tuple *)&iter->buffer[iter->used];
+  tuple->key = key;
+  tuple->type = type;
+  tuple->length = length;
+  memcpy(tuple->value->data, data, length);
+  iter->offsets[iter->count++] = iter->used;
+  iter->used += sizeof(Tuple) + length;
+  return DICT_OK;
+}
+
+Tuple *dict_find(const DictionaryIterator *iter, uint32_t key) {
+  for (int i = 0; i < iter->count; i++) {
+    Tuple *tuple = (Tuple *)&iter->buffer[iter->offsets[i]];
+    if (tuple->key == key) {
+      return tuple;
+    }
+  }
+  return NULL;
+}
+
+Tuple *dict_read_first(DictionaryIterator *iter) {
+  iter->cursor = 0;
+  return dict_read_next(iter);
+}
+
+Tuple *dict_read_next(DictionaryIterator *iter) {
+  if (iter->cursor >= iter->count) {
+    return NULL;
+  }
+  return (Tuple *)&iter->buffer[iter->offsets[iter->cursor++]];
+}
+
+DictionaryResult dict_write_uint8(DictionaryIterator *iter, uint32_t key,
+                                  uint8_t value) {
+  return host_dict_write(iter, key, TUPLE_UINT, &value, sizeof(value));
+}
+
+DictionaryResult dict_write_uint16(DictionaryIterator *iter, uint32_t key,
+                                   uint16_t value) {
+  return host_dict_write(iter, key, TUPLE_UINT, &value, sizeof(value));
+}
+
+DictionaryResult dict_write_uint32(DictionaryIterator *iter, uint32_t key,
+                                   uint32_t value) {
+  return host_dict_write(iter, key, TUPLE_UINT, &value, sizeof(value));
+}
+
+DictionaryResult dict_write_cstring(DictionaryIterator *iter, uint32_t key,
+                                    const char *cstring) {
+  return host_dict_write(iter, key, TUPLE_CSTRING, cstring,
+                         strlen(cstring) + 1);
+}
+
+DictionaryResult dict_write_data(DictionaryIterator *iter, uint32_t key,
+                                 const uint8_t *data, const uint16_t size) {
+  return host_dict_write(iter, key, TUPLE_BYTE_ARRAY, data, size);
+}
+
+static uint32_t s_inbox_size_maximum = 8200;
+static AppMessageInboxReceived s_inbox_received;
+static AppMessageInboxDropped s_inbox_dropped;
+static AppMessageOutboxSent s_outbox_sent;
+static AppMessageOutboxFailed s_outbox_failed;
+
+AppMessageResult app_message_open(const uint32_t size_inbound,
+                                  const uint32_t size_outbound) {
+  return APP_MSG_OK;
+}
+
+uint32_t app_message_inbox_size_maximum(void) { return s_inbox_size_maximum; }
+
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator) {
+  if (s_outbox_busy) {
+    return APP_MSG_BUSY;
+  }
+  dict_reset(&s_outbox);
+  *iterator = &s_outbox;
+  return APP_MSG_OK;
+}
+
+AppMessageResult app_message_outbox_send(void) {
+  s_outbox_busy = true;
+  return APP_MSG_OK;
+}
+
+void app_message_register_inbox_received(AppMessageInboxReceived callback) {
+  s_inbox_received = callback;
+}
+
+void app_message_register_inbox_dropped(AppMessageInboxDropped callback) {
+  s_inbox_dropped = callback;
+}
+
+void app_message_register_outbox_sent(AppMessageOutboxSent callback) {
+  s_outbox_sent = callback;
+}
+
+void app_message_register_outbox_failed(AppMessageOutboxFailed callback) {
+  s_outbox_failed = callback;
+}
+
+void app_message_deregister_callbacks(void) {
+  s_inbox_received = NULL;
+  s_inbox_dropped = NULL;
+  s_outbox_sent = NULL;
+  s_outbox_failed = NULL;
+}
+
+void host_set_inbox_size_maximum(uint32_t size) {
+  s_inbox_size_maximum = size;
+}
+
+DictionaryIterator *host_inbox_begin(void) {
+  dict_reset(&s_inbox);
+  return &s_inbox;
+}
+
+void host_inbox_deliver(void) {
+  if (s_inbox_received) {
+    s_inbox_received(&s_inbox, NULL);
+  }
+}
+
+void host_inbox_drop(AppMessageResult reason) {
+  if (s_inbox_dropped) {
+    s_inbox_dropped(reason, NULL);
+  }
+}
+
+DictionaryIterator *host_outbox_in_flight(void) {
+  return s_outbox_busy ? &s_outbox : NULL;
+}
+
+bool host_outbox_result(bool sent, AppMessageResult reason) {
+  if (!s_outbox_busy) {
+    return false;
+  }
+  s_outbox_busy = false;
+  if (sent) {
+    if (s_outbox_sent) {
+      s_outbox_sent(&s_outbox, NULL);
+    }
+  } else if (s_outbox_failed) {
+    s_outbox_failed(&s_outbox, reason, NULL);
+  }
+  return true;
+}
+
+static struct {
+  uint32_t key;
+  uint16_t size;
+  uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} s_persist[MAX_PERSIST_KEYS];
+static int s_persist_count = 0;
+
+static int persist_find(uint32_t key) {
+  for (int i = 0; i < s_persist_count; i++) {
+    if (s_persist[i].key == key) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool persist_exists(const uint32_t key) { return persist_find(key) >= 0; }
+
+int persist_get_size(const uint32_t key) {
+  int i = persist_find(key);
+  return i < 0 ? -1 : s_persist[i].size;
+}
+
+int persist_read_data(const uint32_t key, void *buffer,
+                      const size_t buffer_size) {
+  int i = persist_find(key);
+  if (i < 0) {
+    return -1;
+  }
+  int size = s_persist[i].size < buffer_size ? s_persist[i].size : buffer_size;
+  memcpy(buffer, s_persist[i].data, size);
+  return size;
+}
+
+int32_t persist_read_int(const uint32_t key) {
+  int32_t value = 0;
+  persist_read_data(key, &value, sizeof(value));
+  return value;
+}
+
+bool persist_read_bool(const uint32_t key) {
+  bool value = false;
+  persist_read_data(key, &value, sizeof(value));
+  return value;
+}
+
+int persist_read_string(const uint32_t key, char *buffer,
+                        const size_t buffer_size) {
+  int size = persist_read_data(key, buffer, buffer_size);
+  if (size > 0) {
+    buffer[size - 1] = '\0';
+  }
+  return size;
+}
+
+int persist_write_data(const uint32_t key, const void *data,
+                       const size_t size) {
+  int i = persist_find(key);
+  if (i < 0) {
+    if (s_persist_count == MAX_PERSIST_KEYS) {
+      return -1;
+    }
+    i = s_persist_count++;
+    s_persist[i].key = key;
+  }
+  s_persist[i].size =
+      size < PERSIST_DATA_MAX_LENGTH ? size : PERSIST_DATA_MAX_LENGTH;
+  memcpy(s_persist[i].data, data, s_persist[i].size);
+  return s_persist[i].size;
+}
+
+int persist_write_int(const uint32_t key, const int32_t value) {
+  return persist_write_data(key, &value, sizeof(value));
+}
+
+int persist_write_bool(const uint32_t key, const bool value) {
+  return persist_write_data(key, &value, sizeof(value));
+}
+
+int persist_write_string(const uint32_t key, const char *cstring) {
+  return persist_write_data(key, cstring, strlen(cstring) + 1);
+}
+
+int persist_delete(const uint32_t key) {
+  int i = persist_find(key);
+  if (i >= 0) {
+    s_persist[i] = s_persist[--s_persist_count];
+  }
+  return 0;
+}
+
+// Windows, layers and clicks: only what drives the app's state is kept
+struct Layer {
+  GRect frame;
+};
+struct Window {
+  WindowHandlers handlers;
+  Layer root;
+};
+struct MenuLayer {
+  Layer layer;
+  MenuLayerCallbacks callbacks;
+  void *context;
+  uint16_t row;
+};
+static Window s_window;
+static MenuLayer s_menu;
+static ClickHandler s_single_clicks[NUM_BUTTONS];
+static ClickHandler s_long_clicks[NUM_BUTTONS];
+static bool s_app_exited = false;
+
+Layer *layer_create(GRect frame) {
+  Layer *layer = calloc(1, sizeof(Layer));
+  layer->frame = frame;
+  return layer;
+}
+
+void layer_destroy(Layer *layer) { free(layer); }
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {}
+void layer_add_child(Layer *parent, Layer *child) {}
+void layer_set_hidden(Layer *layer, bool hidden) {}
+void layer_mark_dirty(Layer *layer) {}
+
+GRect layer_get_bounds(const Layer *layer) {
+  return GRect(0, 0, layer->frame.size.w, layer->frame.size.h);
+}
+
+Window *window_create(void) {
+  s_window.root.frame = GRect(0, 0, 144, 168);
+  return &s_window;
+}
+
+void window_destroy(Window *window) {}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers) {
+  window->handlers = handlers;
+}
+
+void window_set_background_color(Window *window, GColor background_color) {}
+Layer *window_get_root_layer(const Window *window) {
+  return (Layer *)&window->root;
+}
+
+void window_stack_push(Window *window, bool animated) {
+  if (window->handlers.load) {
+    window->handlers.load(window);
+  }
+  if (window->handlers.appear) {
+    window->handlers.appear(window);
+  }
+}
+
+Window *window_stack_pop(bool animated) {
+  s_app_exited = true;
+  return &s_window;
+}
+
+void window_set_click_config_provider(Window *window,
+                                      ClickConfigProvider click_config_provider) {
+  memset(s_single_clicks, 0, sizeof(s_single_clicks));
+  memset(s_long_clicks, 0, sizeof(s_long_clicks));
+  click_config_provider(NULL);
+}
+
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler) {
+  s_single_clicks[button_id] = handler;
+}
+
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms,
+                                 ClickHandler down_handler,
+                                 ClickHandler up_handler) {
+  s_long_clicks[button_id] = down_handler;
+}
+
+// Recognizers passed to handlers are the button id plus one
+ButtonId click_recognizer_get_button_id(ClickRecognizerRef recognizer) {
+  return (ButtonId)((uintptr_t)recognizer - 1);
+}
+
+bool host_click(ButtonId button, bool long_click) {
+  if (button >= NUM_BUTTONS) {
+    return false;
+  }
+  ClickHandler handler =
+      (long_click ? s_long_clicks : s_single_clicks)[button];
+  if (!handler) {
+    return false;
+  }
+  handler((ClickRecognizerRef)(uintptr_t)(button + 1), NULL);
+  return true;
+}
+
+bool host_exited(void) { return s_app_exited; }
+
+MenuLayer *menu_layer_create(GRect frame) {
+  s_menu.layer.frame = frame;
+  return &s_menu;
+}
+
+void menu_layer_destroy(MenuLayer *menu_layer) {}
+
+void menu_layer_set_callbacks(MenuLayer *menu_layer, void *callback_context,
+                              MenuLayerCallbacks callbacks) {
+  menu_layer->callbacks = callbacks;
+  menu_layer->context = callback_context;
+}
+
+Layer *menu_layer_get_layer(const MenuLayer *menu_layer) {
+  return (Layer *)&menu_layer->layer;
+}
+
+static uint16_t menu_rows(MenuLayer *menu_layer) {
+  return menu_layer->callbacks.get_num_rows(menu_layer, 0,
+                                            menu_layer->context);
+}
+
+void menu_layer_reload_data(MenuLayer *menu_layer) {
+  uint16_t rows = menu_rows(menu_layer);
+  if (menu_layer->row >= rows) {
+    menu_layer->row = rows > 0 ? rows - 1 : 0;
+  }
+}
+
+void menu_layer_set_selected_next(MenuLayer *menu_layer, bool up,
+                                  MenuRowAlign scroll_align, bool animated) {
+  if (up && menu_layer->row > 0) {
+    menu_layer->row--;
+  } else if (!up && menu_layer->row + 1 < menu_rows(menu_layer)) {
+    menu_layer->row++;
+  }
+}
+
+MenuIndex menu_layer_get_selected_index(const MenuLayer *menu_layer) {
+  return (MenuIndex){0, menu_layer->row};
+}
+
+void menu_cell_basic_draw(GContext *ctx, const Layer *cell_layer,
+                          const char *title, const char *subtitle,
+                          GBitmap *icon) {}
+
+// Drawing is skipped; text is measured with a fixed advance per character
+GFont fonts_get_system_font(const char *font_key) { return font_key; }
+void graphics_context_set_fill_color(GContext *ctx, GColor color) {}
+void graphics_context_set_stroke_color(GContext *ctx, GColor color) {}
+void graphics_context_set_text_color(GContext *ctx, GColor color) {}
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius,
+                        GCornerMask corner_mask) {}
+void graphics_draw_line(GContext *ctx, GPoint p0, GPoint p1) {}
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius) {}
+void graphics_draw_text(GContext *ctx, const char *text, GFont font,
+                        GRect box, GTextOverflowMode overflow_mode,
+                        GTextAlignment alignment,
+                        GTextAttributes *text_attributes) {}
+
+GSize graphics_text_layout_get_content_size(const char *text, GFont font,
+                                            GRect box,
+                                            GTextOverflowMode overflow_mode,
+                                            GTextAlignment alignment) {
+  int chars = 0;
+  for (const char *c = text; *c; c++) {
+    chars += ((uint8_t)*c & 0xC0) != 0x80;
+  }
+  return GSize(chars * CHAR_WIDTH, TEXT_HEIGHT);
+}
+
+void vibes_enqueue_custom_pattern(VibePattern pattern) {}
+void light_enable_interaction(void) {}
+size_t heap_bytes_free(void) { return 16384; }
+void app_focus_service_subscribe_handlers(AppFocusHandlers handlers) {}
+void app_focus_service_unsubscribe(void) {}
+void app_event_loop(void) {}
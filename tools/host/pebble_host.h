@@ -0,0 +1,50 @@
+#pragma once
+
+// Drives the host stand-in for the Pebble SDK (pebble.h here) from a host
+// program built around src/c/rsvp_news.c: the virtual clock and its timers,
+// messages in both directions, clicks and counters. Nothing runs on its own;
+// the program moves the clock and injects what the phone and the user do.
+
+#include <pebble.h>
+
+#define HOST_EPOCH_MS 1000000 // Virtual time at start, in ms
+
+// Virtual time in ms; time_ms() and the timers follow it
+uint32_t host_clock_ms(void);
+
+// Run the timers due by time_ms in due order, calling after_timer (if set)
+// after each one, then move the clock to time_ms
+void host_run_until(uint32_t time_ms, void (*after_timer)(void));
+
+// Inbound messages: host_inbox_begin() empties the inbox, the dict_write_*()
+// functions or host_dict_write() add tuples, host_inbox_deliver() hands it to
+// the app's inbox callback
+DictionaryIterator *host_inbox_begin(void);
+DictionaryResult host_dict_write(DictionaryIterator *iter, uint32_t key,
+                                 TupleType type, const void *data,
+                                 uint16_t length);
+void host_inbox_deliver(void);
+void host_inbox_drop(AppMessageResult reason);
+
+// The outbox message the app sent and is waiting on, or NULL
+DictionaryIterator *host_outbox_in_flight(void);
+
+// Complete the message in flight as sent or failed; false if there is none
+bool host_outbox_result(bool sent, AppMessageResult reason);
+
+// Press a button; false if the app has no handler for it
+bool host_click(ButtonId button, bool long_click);
+
+// Whether the app popped its window to exit
+bool host_exited(void);
+
+// Sets the inbox size the app is offered
+void host_set_inbox_size_maximum(uint32_t size);
+
+// Called with every app log line, formatted; lines are also printed when
+// HOST_LOG is set in the environment
+extern void (*host_log_hook)(const char *line);
+
+// malloc(), calloc() and realloc() calls made so far by code that includes
+// pebble.h
+unsigned long host_heap_calls(void);
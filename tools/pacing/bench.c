@@ -0,0 +1,163 @@
+// Host benchmark and offline evaluation of the word pacing in rsvp_text.c.
+//
+// Build and run from the repository root:
+//   cc -O2 -Isrc/c tools/pacing/bench.c src/c/rsvp_text.c -o pacing_bench
+//   ./pacing_bench [wpm] [article.txt...]
+//
+// Without articles it reads the English and French samples in
+// tools/host/corpus (en.txt and fr.txt here are the word lists, not texts).
+// For each text it prints the total reading time under the current pacing
+// and under the previous one (Spritz pauses and a fixed extra slot for words
+// over 8 bytes), and the time per word of the weight lookup and of a full
+// delay computation.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rsvp_text.h"
+
+#define MAX_TEXT_WORDS 20000
+
+static const char *const DEFAULT_ARTICLES[] = {
+    "tools/host/corpus/en_article.txt",
+    "tools/host/corpus/fr_article.txt",
+};
+#define TIMING_ROUNDS 200
+
+// The pacing this replaced, for comparison
+static uint32_t legacy_delay(const char *word, uint16_t base_ms) {
+  int len = strlen(word);
+  char last_char = word[len - 1];
+  uint32_t delay = base_ms;
+  if (last_char == '.' || last_char == '!' || last_char == '?') {
+    delay = base_ms * 3;
+  } else if (last_char == ',' || last_char == ':' || last_char == ';' ||
+             last_char == ')') {
+    delay = base_ms * 2;
+  } else if (strchr(word, '(') || strchr(word, '-')) {
+    delay = base_ms + base_ms / 2;
+  }
+  if (len > 8) {
+    delay += base_ms;
+  }
+  return delay;
+}
+
+// Spritz pauses alone: what the current pacing adds up to if the weights
+// average out to the target speed
+static uint32_t pause_only_delay(const char *word, uint16_t base_ms) {
+  uint32_t delay = legacy_delay(word, base_ms);
+  return strlen(word) > 8 ? delay - base_ms : delay;
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static char *read_file(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return NULL;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  size = fread(text, 1, size, file);
+  text[size] = '\0';
+  fclose(file);
+  return text;
+}
+
+static char *s_words[MAX_TEXT_WORDS];
+
+int main(int argc, char **argv) {
+  int first_file = 1;
+  uint16_t wpm = 400;
+  if (argc > 1 && atoi(argv[1]) > 0) {
+    wpm = atoi(argv[1]);
+    first_file = 2;
+  }
+  uint16_t base_ms = 60000 / wpm;
+  printf("%d WPM (%d ms per word)\n", wpm, base_ms);
+
+  const char *const *files = (const char *const *)&argv[first_file];
+  int file_count = argc - first_file;
+  if (file_count == 0) {
+    files = DEFAULT_ARTICLES;
+    file_count = sizeof(DEFAULT_ARTICLES) / sizeof(DEFAULT_ARTICLES[0]);
+  }
+
+  for (int f = 0; f < file_count; f++) {
+    char *text = read_file(files[f]);
+    if (!text) {
+      fprintf(stderr, "Can't read %s\n", files[f]);
+      return 1;
+    }
+    int count = 0;
+    for (char *word = strtok(text, " \t\r\n"); word && count < MAX_TEXT_WORDS;
+         word = strtok(NULL, " \t\r\n")) {
+      s_words[count++] = word;
+    }
+    if (count == 0) {
+      continue;
+    }
+
+    // Offline evaluation: total article time, and the share of listed words
+    PacingState state;
+    pacing_reset(&state);
+    uint64_t current_ms = 0, legacy_ms = 0, pause_ms = 0;
+    uint32_t fastest = UINT32_MAX, slowest = 0;
+    int fast_words = 0, slow_words = 0;
+    for (int i = 0; i < count; i++) {
+      uint32_t delay = calculate_word_delay(&state, s_words[i], base_ms);
+      uint32_t pauses = pause_only_delay(s_words[i], base_ms);
+      pacing_add_word(&state, s_words[i], base_ms);
+      current_ms += delay;
+      legacy_ms += legacy_delay(s_words[i], base_ms);
+      pause_ms += pauses;
+      uint32_t per_slot = delay * 100 / pauses; // % of its base slot
+      fastest = per_slot < fastest ? per_slot : fastest;
+      slowest = per_slot > slowest ? per_slot : slowest;
+      fast_words += per_slot < 100;
+      slow_words += per_slot > 100;
+    }
+    printf("%s: %d words\n", files[f], count);
+    printf("  total: %.1f s now, %.1f s before (%+.1f%%); %.1f s of slots "
+           "and pauses at exactly %d WPM (now %+.1f%%)\n",
+           current_ms / 1000.0, legacy_ms / 1000.0,
+           100.0 * ((double)current_ms / legacy_ms - 1), pause_ms / 1000.0,
+           wpm, 100.0 * ((double)current_ms / pause_ms - 1));
+    printf("  words faster than a slot: %d%%, slower: %d%%, range %d%%-%d%%\n",
+           100 * fast_words / count, 100 * slow_words / count, fastest,
+           slowest);
+
+    // Lookup cost per word
+    volatile uint32_t sink = 0;
+    double start = now_ns();
+    for (int round = 0; round < TIMING_ROUNDS; round++) {
+      for (int i = 0; i < count; i++) {
+        sink += word_weight(s_words[i]);
+      }
+    }
+    double weight_ns = (now_ns() - start) / ((double)TIMING_ROUNDS * count);
+    start = now_ns();
+    for (int round = 0; round < TIMING_ROUNDS; round++) {
+      pacing_reset(&state);
+      for (int i = 0; i < count; i++) {
+        sink += calculate_word_delay(&state, s_words[i], base_ms);
+        pacing_add_word(&state, s_words[i], base_ms);
+      }
+    }
+    double delay_ns = (now_ns() - start) / ((double)TIMING_ROUNDS * count);
+    printf("  host cost per word: %.0f ns weight lookup, %.0f ns delay and "
+           "mean update\n",
+           weight_ns, delay_ns);
+    free(text);
+  }
+  return 0;
+}
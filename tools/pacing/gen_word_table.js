@@ -0,0 +1,118 @@
+// Generates src/c/rsvp_words.h, the word frequency table used to pace words
+// on the watch (see word_weight() in src/c/rsvp_text.c).
+//
+// Usage: node tools/pacing/gen_word_table.js
+//
+// Reads the ranked word lists next to this script (one word per line, most
+// frequent first, '#' starts a comment) and sorts each word into a frequency
+// class by rank. Words are stored as 16-bit hashes of their normalized bytes,
+// not as text, which keeps the table small; a rare word that shares a hash
+// with a listed one is paced as that word.
+
+var fs = require('fs');
+var path = require('path');
+
+var LISTS = ['en.txt', 'fr.txt'];
+var CLASS_RANKS = [64, 160]; // Ranks below 64 are class 0, below 160 class 1
+var WORD_CLASSES = 3;        // Listed words past the last rank are class 2
+var OUTPUT = path.join(__dirname, '..', '..', 'src', 'c', 'rsvp_words.h');
+
+// Normalize a word the way normalize_word() does on the watch: lowercase
+// ASCII and Latin-1 capitals, curly apostrophes as straight ones
+function normalize(word) {
+  var bytes = Buffer.from(word.replace(/’/g, "'"), 'utf8');
+  for (var i = 0; i < bytes.length; i++) {
+    if (bytes[i] >= 0x41 && bytes[i] <= 0x5A) {
+      bytes[i] += 0x20;
+    } else if (bytes[i] === 0xC3 && i + 1 < bytes.length &&
+               bytes[i + 1] >= 0x80 && bytes[i + 1] <= 0x9E && bytes[i + 1] !== 0x97) {
+      bytes[i + 1] += 0x20;
+    }
+  }
+  return bytes;
+}
+
+// 32-bit FNV-1a folded to 16 bits, as hash_word() on the watch
+function hashWord(bytes) {
+  var hash = 0x811C9DC5;
+  for (var i = 0; i < bytes.length; i++) {
+    hash ^= bytes[i];
+    hash = Math.imul(hash, 16777619) >>> 0;
+  }
+  return ((hash >>> 16) ^ (hash & 0xFFFF)) & 0xFFFF;
+}
+
+function classForRank(rank) {
+  for (var c = 0; c < CLASS_RANKS.length; c++) {
+    if (rank < CLASS_RANKS[c]) {
+      return c;
+    }
+  }
+  return WORD_CLASSES - 1;
+}
+
+var classes = {}; // Hash -> most frequent class among the words with it
+var counts = [];
+LISTS.forEach(function (name) {
+  var seen = {};
+  var rank = 0;
+  fs.readFileSync(path.join(__dirname, name), 'utf8').split('\n').forEach(function (line) {
+    var word = line.replace(/#.*/, '').trim();
+    if (word === '' || seen[word]) {
+      return;
+    }
+    seen[word] = true;
+    var hash = hashWord(normalize(word));
+    var wordClass = classForRank(rank++);
+    if (classes[hash] === undefined || wordClass < classes[hash]) {
+      classes[hash] = wordClass;
+    }
+  });
+  counts.push(name + ': ' + rank + ' words');
+});
+
+var hashes = Object.keys(classes).map(Number).sort(function (a, b) { return a - b; });
+
+// Classes packed four to a byte, lowest bits first
+var packed = [];
+hashes.forEach(function (hash, i) {
+  packed[i >> 2] = (packed[i >> 2] || 0) | (classes[hash] << ((i & 3) * 2));
+});
+
+function rows(values, perRow, format) {
+  var lines = [];
+  for (var i = 0; i < values.length; i += perRow) {
+    lines.push('    ' + values.slice(i, i + perRow).map(format).join(', ') + ',');
+  }
+  return lines.join('\n');
+}
+
+function hex(digits) {
+  return function (value) {
+    return '0x' + ('0000' + value.toString(16).toUpperCase()).slice(-digits);
+  };
+}
+
+var out = [
+  '// Generated by tools/pacing/gen_word_table.js from ' + LISTS.join(', ') + '. Do not edit.',
+  '// ' + counts.join(', ') + '; ' + hashes.length + ' hashes.',
+  '#pragma once',
+  '',
+  '#include <stdint.h>',
+  '',
+  '#define WORD_TABLE_SIZE ' + hashes.length,
+  '',
+  '// Sorted 16-bit hashes of the listed words',
+  'static const uint16_t WORD_TABLE_HASHES[WORD_TABLE_SIZE] = {',
+  rows(hashes, 8, hex(4)),
+  '};',
+  '',
+  '// Frequency class of each hash (0 = most frequent), four per byte',
+  'static const uint8_t WORD_TABLE_CLASSES[(WORD_TABLE_SIZE + 3) / 4] = {',
+  rows(packed, 12, hex(2)),
+  '};',
+  ''
+].join('\n');
+
+fs.writeFileSync(OUTPUT, out);
+console.log('Wrote ' + OUTPUT + ': ' + counts.join(', ') + ', ' + hashes.length + ' hashes');
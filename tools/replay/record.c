@@ -0,0 +1,280 @@
+// Records a scripted session of the watch app on the host, for the traces
+// in tools/replay/traces that run_traces.sh replays.
+//
+// Build and run from the repository root:
+//   cc -std=gnu99 -Itools/host -Isrc/c -o trace_record
+//       tools/replay/record.c tools/host/pebble_host.c src/c/rsvp_text.c
+//   ./trace_record read|starved > tools/replay/traces/<name>.log
+//
+// A TRACE_RECORD build of src/c/rsvp_news.c runs on the virtual clock of
+// tools/host and its app log is printed as `pebble logs` shows it. A phone
+// stand-in answers the app's messages after a fixed link delay: the feed
+// list, title batches of the headlines in tools/host/corpus, and article
+// chunks of its English article. Clicks come from the scenario:
+//   read     pick a feed, read a headline's article, go back to the titles,
+//            open the diagnostics screen and leave with Back; aplite's
+//            512-byte inbox, so the article comes in several chunks
+//   starved  the same article in small chunks on a slow link, so the reader
+//            catches up with the stream and waits for each chunk
+//
+// Traces from a watch (TRACE_RECORD=1 builds, `pebble logs`) replay the
+// same way; these ones exist so a regression can be caught without one.
+
+#define TRACE_RECORD 1
+#define main watch_main
+#include "rsvp_news.c"
+#undef main
+
+#include "pebble_host.h"
+
+#define CORPUS "tools/host/corpus"
+#define STEP_MS 10              // Clock step between phone and click checks
+#define PHONE_ACK_MS 40         // Outbox message to its sent result
+#define MAX_PENDING 8           // Messages on their way to the watch
+#define TITLE_MESSAGE_OVERHEAD 32 // As in JS: headers around a title batch
+#define FEED_LIST_HASH 0x5eed1157
+
+typedef struct {
+  uint32_t time_ms;     // Since the start
+  ButtonId button;
+  bool long_click;
+} ScriptClick;
+
+typedef struct {
+  const char *name;
+  uint32_t inbox_size;     // Inbox size maximum the app is offered
+  uint32_t chunk_delay_ms; // Article request to its chunk
+  uint32_t title_delay_ms; // Ack to the title batches it opens
+  uint32_t end_ms;
+  const ScriptClick *clicks;
+  uint8_t click_count;
+} Scenario;
+
+static const ScriptClick READ_CLICKS[] = {
+    {1000, BUTTON_ID_SELECT, false},  // First feed
+    {4000, BUTTON_ID_SELECT, false},  // Read the headline's article
+    {30000, BUTTON_ID_UP, false},     // Back to the headline
+    {31000, BUTTON_ID_SELECT, false}, // Read it again
+    {45000, BUTTON_ID_SELECT, true},  // Diagnostics
+    {47000, BUTTON_ID_DOWN, false},
+    {60000, BUTTON_ID_BACK, false},
+};
+
+static const ScriptClick STARVED_CLICKS[] = {
+    {1000, BUTTON_ID_SELECT, false},
+    {4000, BUTTON_ID_SELECT, false},
+    {50000, BUTTON_ID_BACK, false},
+};
+
+static const Scenario SCENARIOS[] = {
+    {"read", 512, 80, 60, 61000, READ_CLICKS, ARRAY_LENGTH(READ_CLICKS)},
+    {"starved", 256, 6000, 60, 52000, STARVED_CLICKS,
+     ARRAY_LENGTH(STARVED_CLICKS)},
+};
+
+// A message on its way from the phone
+typedef struct {
+  uint32_t due_ms;
+  uint32_t key;         // KEY_NEWS_TITLES, KEY_NEWS_ARTICLE or KEY_FEED_LIST
+  uint16_t seq;         // Batch or chunk
+  uint8_t index;        // Article
+} Pending;
+
+static const Scenario *s_scenario;
+static Pending s_pending[MAX_PENDING];
+static uint8_t s_pending_count = 0;
+static char *s_titles[64];
+static uint8_t s_title_count = 0;
+static uint8_t s_batch_first[65]; // First title of each batch, then the count
+static uint16_t s_batch_count = 0;
+static uint16_t s_batches_sent = 0;
+static uint16_t s_batches_acked = 0;
+static char *s_article;
+
+static char *read_text(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    fprintf(stderr, "Can't read %s\n", path);
+    exit(2);
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  size = fread(text, 1, size, file);
+  text[size] = '\0';
+  fclose(file);
+  return text;
+}
+
+static void print_log_line(const char *line) { printf("%s\n", line); }
+
+static void phone_send(uint32_t delay_ms, uint32_t key, uint16_t seq,
+                       uint8_t index) {
+  if (s_pending_count == MAX_PENDING) {
+    return;
+  }
+  s_pending[s_pending_count++] =
+      (Pending){host_clock_ms() + delay_ms, key, seq, index};
+}
+
+// Split the titles into batches that fit the app's inbox, as JS does; the
+// end marker takes a batch of its own when the last one is full
+static void build_title_batches(void) {
+  uint16_t limit = s_inbox_size - TITLE_MESSAGE_OVERHEAD;
+  uint16_t used = 0;
+  s_batch_first[s_batch_count++] = 0;
+  for (uint8_t i = 0; i < s_title_count; i++) {
+    uint16_t size = 1 + strlen(s_titles[i]);
+    if (used + size > limit) {
+      s_batch_first[s_batch_count++] = i;
+      used = 0;
+    }
+    used += size;
+  }
+  if (used + 1 > limit) {
+    s_batch_first[s_batch_count++] = s_title_count;
+  }
+  s_batch_first[s_batch_count] = s_title_count;
+}
+
+// Deliver a message that reached the watch, as JS would have built it
+static void phone_deliver(const Pending *message) {
+  DictionaryIterator *in = host_inbox_begin();
+  if (message->key == KEY_FEED_LIST) {
+    static const char FEEDS[] = "World\0Europe\0";
+    dict_write_uint32(in, KEY_FEED_LIST_HASH, FEED_LIST_HASH);
+    dict_write_data(in, KEY_FEED_LIST, (const uint8_t *)FEEDS,
+                    sizeof(FEEDS) - 1);
+  } else if (message->key == KEY_NEWS_TITLES) {
+    uint8_t batch[1024];
+    uint16_t used = 0;
+    for (uint8_t i = s_batch_first[message->seq];
+         i < s_batch_first[message->seq + 1]; i++) {
+      uint8_t length = strlen(s_titles[i]);
+      batch[used++] = length;
+      memcpy(&batch[used], s_titles[i], length);
+      used += length;
+    }
+    if (message->seq + 1 == s_batch_count) {
+      batch[used++] = 0; // End of the feed
+    }
+    dict_write_data(in, KEY_NEWS_TITLES, batch, used);
+    dict_write_uint16(in, KEY_NEWS_SEQ, message->seq);
+  } else {
+    // Plain UTF-8 text is its own packed form
+    size_t length = strlen(s_article);
+    size_t start = (size_t)message->seq * s_article_chunk_max;
+    size_t size = length - start < s_article_chunk_max ? length - start
+                                                       : s_article_chunk_max;
+    dict_write_data(in, KEY_NEWS_ARTICLE, (const uint8_t *)&s_article[start],
+                    size);
+    dict_write_uint8(in, KEY_ARTICLE_INDEX, message->index);
+    dict_write_uint16(in, KEY_ARTICLE_SEQ, message->seq);
+    dict_write_uint8(in, KEY_ARTICLE_DONE, start + size >= length);
+  }
+  host_inbox_deliver();
+}
+
+// Answer the message the app sent, as JS does
+static void phone_receive(DictionaryIterator *out) {
+  Tuple *tuple;
+  if ((tuple = dict_find(out, KEY_REQUEST_ARTICLE))) {
+    Tuple *seq = dict_find(out, KEY_ARTICLE_SEQ);
+    phone_send(s_scenario->chunk_delay_ms, KEY_NEWS_ARTICLE,
+               seq ? seq->value->uint16 : 0, tuple->value->uint8);
+  } else if (dict_find(out, KEY_SELECT_FEED)) {
+    phone_send(s_scenario->title_delay_ms, KEY_NEWS_TITLES, 0, 0);
+    s_batches_sent = 1;
+    s_batches_acked = 0;
+  } else if ((tuple = dict_find(out, KEY_NEWS_ACK))) {
+    // Send up to the window; an ack that did not move on asks for a resend
+    Tuple *window = dict_find(out, KEY_NEWS_WINDOW);
+    uint16_t ack = tuple->value->uint16;
+    uint16_t end = ack + (window ? window->value->uint8 : 0);
+    if (ack <= s_batches_acked && ack < s_batches_sent) {
+      s_batches_sent = ack;
+    }
+    s_batches_acked = ack;
+    while (s_batches_sent < end && s_batches_sent < s_batch_count) {
+      phone_send(s_scenario->title_delay_ms, KEY_NEWS_TITLES,
+                 s_batches_sent++, 0);
+    }
+  } else if (dict_find(out, KEY_REQUEST_FEEDS)) {
+    phone_send(s_scenario->title_delay_ms, KEY_FEED_LIST, 0, 0);
+  }
+}
+
+// Move the phone on to the current time: finish the message in flight and
+// deliver the ones due
+static void phone_step(uint32_t *outbox_since_ms) {
+  DictionaryIterator *out = host_outbox_in_flight();
+  if (!out) {
+    *outbox_since_ms = 0;
+  } else if (*outbox_since_ms == 0) {
+    *outbox_since_ms = host_clock_ms();
+  } else if (host_clock_ms() - *outbox_since_ms >= PHONE_ACK_MS) {
+    phone_receive(out);
+    *outbox_since_ms = 0;
+    host_outbox_result(true, APP_MSG_OK);
+  }
+
+  for (uint8_t i = 0; i < s_pending_count; i++) {
+    if ((int32_t)(host_clock_ms() - s_pending[i].due_ms) >= 0) {
+      Pending message = s_pending[i];
+      memmove(&s_pending[i], &s_pending[i + 1],
+              (--s_pending_count - i) * sizeof(Pending));
+      phone_deliver(&message);
+      return; // One message per step, as the inbox holds one
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  for (uint8_t i = 0; argc == 2 && i < ARRAY_LENGTH(SCENARIOS); i++) {
+    if (strcmp(argv[1], SCENARIOS[i].name) == 0) {
+      s_scenario = &SCENARIOS[i];
+    }
+  }
+  if (!s_scenario) {
+    fprintf(stderr, "Usage: %s read|starved\n", argv[0]);
+    return 2;
+  }
+
+  for (char *line = strtok(read_text(CORPUS "/headlines.txt"), "\n");
+       line && s_title_count < ARRAY_LENGTH(s_titles);
+       line = strtok(NULL, "\n")) {
+    s_titles[s_title_count++] = line;
+  }
+  s_article = read_text(CORPUS "/en_article.txt");
+  for (char *c = s_article; *c; c++) {
+    if (*c == '\n') {
+      *c = ' ';
+    }
+  }
+
+  host_log_hook = print_log_line;
+  host_set_inbox_size_maximum(s_scenario->inbox_size);
+  init();
+  build_title_batches();
+  // JS announces the feed list once it is ready
+  phone_send(200, KEY_FEED_LIST, 0, 0);
+
+  uint8_t next_click = 0;
+  uint32_t outbox_since_ms = 0;
+  for (uint32_t t = 0; t <= s_scenario->end_ms && !host_exited();
+       t += STEP_MS) {
+    host_run_until(HOST_EPOCH_MS + t, NULL);
+    phone_step(&outbox_since_ms);
+    if (next_click < s_scenario->click_count &&
+        s_scenario->clicks[next_click].time_ms <= t) {
+      const ScriptClick *click = &s_scenario->clicks[next_click++];
+      if (!host_click(click->button, click->long_click)) {
+        fprintf(stderr, "%u ms: no handler for button %d\n", t,
+                click->button);
+      }
+    }
+  }
+  deinit();
+  return 0;
+}
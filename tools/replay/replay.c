@@ -0,0 +1,443 @@
+// Replays a session trace recorded by a TRACE_RECORD build of the watch app
+// (see src/c/rsvp_trace.h) against src/c/rsvp_news.c on the host.
+//
+// Build and run from the repository root:
+//   cc -std=gnu99 -Itools/host -Isrc/c -o trace_replay
+//       tools/replay/replay.c tools/host/pebble_host.c src/c/rsvp_text.c
+//   ./trace_replay [-q] [-w trace.bin] session.log|trace.bin
+//
+// The input is an app log holding TRACE lines (from `pebble logs`) or a
+// binary trace saved with -w. Recorded clicks, messages and outbox results
+// are fed to the app at their recorded times on a virtual clock, and its
+// timers run from that clock, so a replay is deterministic. The app records
+// its own trace while replaying; its timed events are compared with the
+// recorded ones, which also shows how late they ran on the watch.
+//
+// Prints the state transitions (unless -q), time to the first title and
+// article words, and words shown. Exits with 0 when the timed events match
+// the recording, 1 when they diverge and 2 when the trace can't be read.
+//
+// The app runs on the host stand-in for the SDK in tools/host; set HOST_LOG
+// to print its log as it runs. Text is measured with a fixed advance per
+// character, so with word groups on, flashes can be grouped differently than
+// on the watch.
+
+#define TRACE_RECORD 1
+#define main watch_main
+#include "rsvp_news.c"
+#undef main
+
+#include "pebble_host.h"
+
+// ---- Trace streams ----
+
+typedef struct {
+  uint8_t *bytes;
+  size_t length;
+  size_t capacity;
+  uint16_t next_line; // Next TRACE line number expected
+  bool broken;        // A line was missing or malformed
+} TraceStream;
+
+typedef struct {
+  TraceKind kind;
+  uint32_t time_ms; // Since the first record
+  uint32_t length;
+  const uint8_t *payload;
+} TraceRecord;
+
+static void stream_append(TraceStream *stream, uint8_t byte) {
+  if (stream->length == stream->capacity) {
+    stream->capacity = stream->capacity ? stream->capacity * 2 : 4096;
+    stream->bytes = realloc(stream->bytes, stream->capacity);
+  }
+  stream->bytes[stream->length++] = byte;
+}
+
+static int hex_digit(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+// Add the bytes of a "TRACE <line number> <hex>" log line, wherever it
+// starts in text
+static void stream_add_line(TraceStream *stream, const char *text) {
+  const char *start = strstr(text, "TRACE ");
+  if (!start) {
+    return;
+  }
+  char *hex;
+  long number = strtol(start + 6, &hex, 10);
+  if (number != stream->next_line || *hex != ' ') {
+    fprintf(stderr, "Trace line %ld found where %d was expected\n", number,
+            stream->next_line);
+    stream->broken = true;
+  }
+  stream->next_line = number + 1;
+  for (hex++; hex_digit(hex[0]) >= 0 && hex_digit(hex[1]) >= 0; hex += 2) {
+    stream_append(stream, hex_digit(hex[0]) << 4 | hex_digit(hex[1]));
+  }
+}
+
+static bool read_varint(const TraceStream *stream, size_t *pos,
+                        uint32_t *value) {
+  *value = 0;
+  for (int shift = 0; shift < 32 && *pos < stream->length; shift += 7) {
+    uint8_t byte = stream->bytes[(*pos)++];
+    *value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Split a stream into records; the count, or -1 if it is malformed
+static int parse_records(const TraceStream *stream, TraceRecord **records) {
+  int count = 0;
+  int capacity = 0;
+  uint32_t time_ms = 0;
+  size_t pos = 0;
+  *records = NULL;
+  while (pos < stream->length) {
+    TraceRecord record = {.kind = stream->bytes[pos++]};
+    uint32_t delay;
+    if (record.kind < TRACE_START || record.kind > TRACE_END ||
+        !read_varint(stream, &pos, &delay) ||
+        !read_varint(stream, &pos, &record.length) ||
+        record.length > stream->length - pos) {
+      fprintf(stderr, "Malformed trace record at byte %zu\n", pos);
+      return -1;
+    }
+    time_ms += delay;
+    record.time_ms = time_ms;
+    record.payload = &stream->bytes[pos];
+    pos += record.length;
+    if (count == capacity) {
+      capacity = capacity ? capacity * 2 : 256;
+      *records = realloc(*records, capacity * sizeof(TraceRecord));
+    }
+    (*records)[count++] = record;
+  }
+  return count;
+}
+
+static uint16_t read_u16(const uint8_t *bytes) {
+  return bytes[0] | bytes[1] << 8;
+}
+
+static uint32_t read_u32(const uint8_t *bytes) {
+  return read_u16(bytes) | (uint32_t)read_u16(&bytes[2]) << 16;
+}
+
+// ---- Replay ----
+
+static TraceStream s_replay_stream; // What the app records while replaying
+
+// The app's TRACE lines make up its trace of the replay
+static void capture_trace_line(const char *line) {
+  if (strncmp(line, "TRACE ", 6) == 0) {
+    stream_add_line(&s_replay_stream, line);
+  }
+}
+
+static bool s_quiet = false;
+
+// App state reported as it changes
+#define WATCHED_FLAGS(X)                                                       \
+  X(s_showing_menu)                                                            \
+  X(s_waiting_for_config)                                                      \
+  X(s_reading_article)                                                         \
+  X(s_article_starved)                                                         \
+  X(s_user_navigating)                                                         \
+  X(s_showing_page_number)                                                     \
+  X(s_showing_diagnostics)                                                     \
+  X(s_paused)                                                                  \
+  X(s_end_screen)
+#define FLAG_NAME(flag) #flag,
+#define FLAG_VALUE(flag) flag,
+static const char *const FLAG_NAMES[] = {WATCHED_FLAGS(FLAG_NAME)};
+#define FLAG_COUNT ARRAY_LENGTH(FLAG_NAMES)
+
+typedef struct {
+  bool flags[FLAG_COUNT];
+  uint16_t pacing_words;
+  uint16_t pacing_flashes;
+  uint16_t first_title_ms;
+  uint32_t words_shown;
+  uint32_t flashes_shown;
+  uint16_t transitions;
+  uint16_t articles;
+  uint32_t first_word_total_ms;
+  uint16_t first_word_max_ms;
+} ReplayState;
+static ReplayState s_state;
+
+static double replay_seconds(void) {
+  return (host_clock_ms() - HOST_EPOCH_MS) / 1000.0;
+}
+
+// Compare the app's state with the last check and report what changed
+static void check_state(void) {
+  bool flags[] = {WATCHED_FLAGS(FLAG_VALUE)};
+  for (size_t i = 0; i < FLAG_COUNT; i++) {
+    if (flags[i] != s_state.flags[i]) {
+      if (!s_quiet) {
+        printf("%9.3f  %s %d -> %d\n", replay_seconds(), FLAG_NAMES[i],
+               s_state.flags[i], flags[i]);
+      }
+      s_state.flags[i] = flags[i];
+      s_state.transitions++;
+
+      // An article starts: Select to its first word
+      if (flags[i] && strcmp(FLAG_NAMES[i], "s_reading_article") == 0) {
+        s_state.articles++;
+        s_state.first_word_total_ms += s_perf.first_word_ms;
+        if (s_perf.first_word_ms > s_state.first_word_max_ms) {
+          s_state.first_word_max_ms = s_perf.first_word_ms;
+        }
+        if (!s_quiet) {
+          printf("%9.3f  article %d: first word %d ms after Select\n",
+                 replay_seconds(), s_state.articles, s_perf.first_word_ms);
+        }
+      }
+    }
+  }
+
+  if (s_perf.first_title_ms != s_state.first_title_ms) {
+    s_state.first_title_ms = s_perf.first_title_ms;
+    if (!s_quiet) {
+      printf("%9.3f  first title word %d ms after the feed selection\n",
+             replay_seconds(), s_perf.first_title_ms);
+    }
+  }
+
+  // Pacing counters restart with each text
+  s_state.words_shown += s_pacing_words >= s_state.pacing_words
+                             ? s_pacing_words - s_state.pacing_words
+                             : s_pacing_words;
+  s_state.flashes_shown += s_pacing_flashes >= s_state.pacing_flashes
+                               ? s_pacing_flashes - s_state.pacing_flashes
+                               : s_pacing_flashes;
+  s_state.pacing_words = s_pacing_words;
+  s_state.pacing_flashes = s_pacing_flashes;
+}
+
+static void replay_click(const TraceRecord *record) {
+  uint8_t button = record->payload[0];
+  if (!host_click(button, record->payload[1])) {
+    fprintf(stderr, "%9.3f  no handler for button %d\n", replay_seconds(),
+            button);
+  }
+}
+
+static void replay_inbox(const TraceRecord *record) {
+  DictionaryIterator *inbox = host_inbox_begin();
+  for (uint32_t pos = 0; pos + 7 <= record->length;) {
+    uint16_t length = read_u16(&record->payload[pos + 5]);
+    if (pos + 7 + length > record->length) {
+      break;
+    }
+    host_dict_write(inbox, read_u32(&record->payload[pos]),
+                    record->payload[pos + 4], &record->payload[pos + 7],
+                    length);
+    pos += 7 + length;
+  }
+  host_inbox_deliver();
+}
+
+static const char *event_name(uint8_t type) {
+  static const char *const NAMES[EVENT_TYPE_COUNT] = {
+      [EVENT_RSVP] = "rsvp",
+      [EVENT_RSVP_START] = "rsvp start",
+      [EVENT_PAGE_NUMBER] = "page number",
+      [EVENT_NEWS] = "news",
+      [EVENT_END] = "end",
+  };
+  return type < EVENT_TYPE_COUNT ? NAMES[type] : "unknown";
+}
+
+// Compare the timed events of the recording with the replay's; true if
+// they are the same events in the same order
+static bool compare_events(const TraceRecord *recorded, int recorded_count,
+                           const TraceRecord *replayed, int replayed_count) {
+  int a = 0, b = 0, matched = 0;
+  int32_t late_total = 0, late_max = 0;
+  bool same = true;
+  while (true) {
+    while (a < recorded_count && recorded[a].kind != TRACE_EVENT) {
+      a++;
+    }
+    while (b < replayed_count && replayed[b].kind != TRACE_EVENT) {
+      b++;
+    }
+    if (a == recorded_count || b == replayed_count) {
+      same = a == recorded_count && b == replayed_count;
+      break;
+    }
+    if (recorded[a].payload[0] != replayed[b].payload[0]) {
+      printf("Timed event %d differs: %s at %.3f s recorded, %s at %.3f s "
+             "replayed\n",
+             matched + 1, event_name(recorded[a].payload[0]),
+             recorded[a].time_ms / 1000.0, event_name(replayed[b].payload[0]),
+             replayed[b].time_ms / 1000.0);
+      same = false;
+      break;
+    }
+    // How much later the event ran on the watch than on the virtual clock
+    int32_t late = (int32_t)(recorded[a].time_ms - replayed[b].time_ms);
+    late_total += late;
+    late_max = late > late_max ? late : late_max;
+    matched++;
+    a++;
+    b++;
+  }
+  printf("Timed events: %d matched%s; on the watch they ran %d ms later on "
+         "average, %d ms at most\n",
+         matched, same ? "" : ", then diverged",
+         matched ? (int)(late_total / matched) : 0, (int)late_max);
+  return same;
+}
+
+static char *read_file(const char *path, size_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return NULL;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *data = malloc(size + 1);
+  *length = fread(data, 1, size, file);
+  data[*length] = '\0';
+  fclose(file);
+  return data;
+}
+
+int main(int argc, char **argv) {
+  const char *input = NULL;
+  const char *output = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-q") == 0) {
+      s_quiet = true;
+    } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else {
+      input = argv[i];
+    }
+  }
+  if (!input) {
+    fprintf(stderr, "Usage: %s [-q] [-w trace.bin] session.log|trace.bin\n",
+            argv[0]);
+    return 2;
+  }
+
+  size_t length;
+  char *data = read_file(input, &length);
+  if (!data) {
+    fprintf(stderr, "Can't read %s\n", input);
+    return 2;
+  }
+
+  // A log holds TRACE lines; anything else is a binary trace
+  TraceStream recorded = {0};
+  if (strstr(data, "TRACE ")) {
+    for (char *line = strtok(data, "\n"); line; line = strtok(NULL, "\n")) {
+      stream_add_line(&recorded, line);
+    }
+  } else {
+    recorded.bytes = (uint8_t *)data;
+    recorded.length = length;
+  }
+  TraceRecord *records;
+  int count = parse_records(&recorded, &records);
+  if (recorded.broken || count <= 0 || records[0].kind != TRACE_START ||
+      records[0].length < 5 || records[0].payload[0] != TRACE_VERSION) {
+    fprintf(stderr, "%s is not a complete version %d trace\n", input,
+            TRACE_VERSION);
+    return 2;
+  }
+  if (output) {
+    FILE *file = fopen(output, "wb");
+    if (!file || fwrite(recorded.bytes, 1, recorded.length, file) !=
+                     recorded.length) {
+      fprintf(stderr, "Can't write %s\n", output);
+      return 2;
+    }
+    fclose(file);
+  }
+
+  // The session starts from the recorded inbox size and persisted state
+  host_set_inbox_size_maximum(read_u32(&records[0].payload[1]));
+  int next = 1;
+  for (; next < count && records[next].kind == TRACE_PERSIST; next++) {
+    persist_write_data(read_u32(records[next].payload),
+                       &records[next].payload[4], records[next].length - 4);
+  }
+
+  host_log_hook = capture_trace_line;
+  init();
+  check_state();
+  int clicks = 0, messages = 0, outbox_results = 0, unmatched_results = 0;
+  uint32_t end_ms = records[count - 1].time_ms;
+  for (; next < count && !host_exited(); next++) {
+    const TraceRecord *record = &records[next];
+    host_run_until(HOST_EPOCH_MS + record->time_ms, check_state);
+    if (host_exited()) {
+      break;
+    }
+    switch (record->kind) {
+    case TRACE_CLICK:
+      clicks++;
+      replay_click(record);
+      break;
+    case TRACE_INBOX:
+      messages++;
+      replay_inbox(record);
+      break;
+    case TRACE_INBOX_DROPPED:
+      host_inbox_drop(read_u16(record->payload));
+      break;
+    case TRACE_OUTBOX_SENT:
+    case TRACE_OUTBOX_FAILED:
+      outbox_results++;
+      if (!host_outbox_result(record->kind == TRACE_OUTBOX_SENT,
+                              record->kind == TRACE_OUTBOX_FAILED
+                                  ? read_u16(record->payload)
+                                  : APP_MSG_OK)) {
+        unmatched_results++;
+      }
+      break;
+    default:
+      break;
+    }
+    check_state();
+  }
+  host_run_until(HOST_EPOCH_MS + end_ms, check_state);
+  deinit();
+
+  TraceRecord *replayed;
+  int replayed_count = parse_records(&s_replay_stream, &replayed);
+  printf("Trace: %d records over %.1f s, %d clicks, %d messages in, %d "
+         "outbox results (%d with no message in flight)\n",
+         count, end_ms / 1000.0, clicks, messages, outbox_results,
+         unmatched_results);
+  printf("Words shown: %lu in %lu flashes; %d state transitions\n",
+         (unsigned long)s_state.words_shown,
+         (unsigned long)s_state.flashes_shown, s_state.transitions);
+  printf("First title word: %d ms after the feed selection; first article "
+         "word: %d ms on average, %d ms at most, over %d articles\n",
+         s_state.first_title_ms,
+         s_state.articles ? (int)(s_state.first_word_total_ms /
+                                  s_state.articles)
+                          : 0,
+         s_state.first_word_max_ms, s_state.articles);
+  bool same = replayed_count >= 0 &&
+              compare_events(records, count, replayed, replayed_count);
+  return same ? 0 : 1;
+}
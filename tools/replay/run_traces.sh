@@ -0,0 +1,49 @@
+#!/bin/sh
+# Replays every session trace in tools/replay/traces and fails when one does
+# not give the exit replay.c promises for it.
+#
+# Run from the repository root:
+#   sh tools/replay/run_traces.sh
+#
+# A trace named *.diverged.log must diverge (exit 1); any other must match
+# (exit 0). Each matching trace is also replayed with one TRACE line cut,
+# which must be reported as unreadable (exit 2).
+#
+# read.log and starved.log were recorded with record.c. The diverged one is
+# read.log with the Select press that opens the article moved 2 s later.
+
+set -u
+dir=$(dirname "$0")
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+${CC:-cc} -std=gnu99 -Itools/host -Isrc/c -o "$tmp/trace_replay" \
+  "$dir/replay.c" tools/host/pebble_host.c src/c/rsvp_text.c || exit 2
+
+failed=0
+expect() {
+  "$tmp/trace_replay" -q "$2" > "$tmp/out" 2>&1
+  code=$?
+  if [ "$code" -ne "$1" ]; then
+    echo "FAIL $2: exit $code, expected $1"
+    sed 's/^/  /' "$tmp/out"
+    failed=1
+  else
+    echo "ok   $2: exit $code"
+  fi
+}
+
+for trace in "$dir"/traces/*.log; do
+  case "$trace" in
+    *.diverged.log)
+      expect 1 "$trace"
+      ;;
+    *)
+      expect 0 "$trace"
+      cut="$tmp/$(basename "$trace" .log).cut.log"
+      grep -v '^TRACE 3 ' "$trace" > "$cut"
+      expect 2 "$cut"
+      ;;
+  esac
+done
+exit $failed